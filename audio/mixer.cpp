@@ -21,6 +21,7 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
@@ -301,6 +302,7 @@ void MixerImpl::playStream(
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
+	PROFILE_SCOPE_TRACK("Mixer::mixCallback", Common::kProfilerTrackAudio);
 	Common::StackLock lock(_mutex);
 
 	int16 *buf = (int16 *)samples;
@@ -321,7 +323,7 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	}
 
 	// mix all channels
-	int res = 0, tmp;
+	int res = 0, tmp, mixed = 0;
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		if (_channels[i]) {
 			if (_channels[i]->isFinished()) {
@@ -329,12 +331,16 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 				_channels[i] = nullptr;
 			} else if (!_channels[i]->isPaused()) {
 				tmp = _channels[i]->mix(buf, len);
+				mixed++;
 
 				if (tmp > res)
 					res = tmp;
 			}
 		}
 
+	if (Common::Profiler::isActive())
+		ProfMan.setCounter("Mixer channels", mixed, Common::kProfilerTrackAudio);
+
 	return res;
 }
 
@@ -82,9 +82,11 @@ void DefaultEventManager::init() {
 bool DefaultEventManager::pollEvent(Common::Event &event) {
 	_dispatcher.dispatch();
 
-	if (g_engine)
-		// Handle autosaves if enabled
+	if (g_engine) {
+		// Handle autosaves and rewind snapshots if enabled
 		g_engine->handleAutoSave();
+		g_engine->handleRewindSnapshot();
+	}
 
 	if (_eventQueue.empty()) {
 		return false;
@@ -203,6 +205,12 @@ bool DefaultEventManager::pollEvent(Common::Event &event) {
 			g_engine->flipMute();
 		break;
 
+	case Common::EVENT_REWIND:
+		if (g_engine && !g_engine->isPaused())
+			g_engine->rewindGameState();
+		forwardEvent = false;
+		break;
+
 	case Common::EVENT_QUIT:
 		if (g_engine && !g_engine->hasFeature(Engine::kSupportsQuitDialogOverride) && ConfMan.getBool("confirm_exit")) {
 			if (_confirmExitDialogActive) {
@@ -354,6 +362,13 @@ Common::Keymap *DefaultEventManager::getGlobalKeymap() {
 	act->setEvent(EVENT_MUTE);
 	globalKeymap->addAction(act);
 
+	act = new Action("REWIND", _("Rewind game state"));
+	// No default mapping here, rewinding is disabled by default and the key
+	// should not be taken away from games with text input. runGame() maps it
+	// for the games which have rewind_period set.
+	act->setEvent(EVENT_REWIND);
+	globalKeymap->addAction(act);
+
 	if (!g_system->hasFeature(OSystem::kFeatureNoQuit)) {
 		act = new Action("QUIT", _("Quit"));
 		act->setEvent(EVENT_QUIT);
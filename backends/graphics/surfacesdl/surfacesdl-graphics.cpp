@@ -191,7 +191,10 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 #endif
 	_transactionMode(kTransactionNone),
 	_scalerPlugins(ScalerMan.getPlugins()), _scalerPlugin(nullptr), _scaler(nullptr),
-	_needRestoreAfterOverlay(false), _isInOverlayPalette(false), _isDoubleBuf(false), _prevForceRedraw(false), _numPrevDirtyRects(0),
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	_scalerWorkers(nullptr), _numScalerWorkers(-1), _scalerWorkersQuit(false), _scalerDone(nullptr),
+#endif
+	_needRestoreAfterOverlay(false), _isInOverlayPalette(false), _isDoubleBuf(false), _prevForceRedraw(false),
 	_prevCursorNeedsRedraw(false),
 	_mouseKeyColor(0), _disableMouseKeyColor(false) {
 
@@ -240,6 +243,9 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 }
 
 SurfaceSdlGraphicsManager::~SurfaceSdlGraphicsManager() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	stopScalerWorkers();
+#endif
 	unloadGFXMode();
 	delete _scaler;
 	delete _mouseScaler;
@@ -1403,7 +1409,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 
 	// In case of double buferring partially good version may be on another page,
 	// so we need to fully redraw
-	if (_isDoubleBuf && _numDirtyRects)
+	if (_isDoubleBuf && !_dirtyRegion.isEmpty())
 		_forceRedraw = true;
 
 #if defined(USE_IMGUI) && (defined(USE_IMGUI_SDLRENDERER2) || defined(USE_IMGUI_SDLRENDERER3))
@@ -1413,27 +1419,39 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 #endif
 
 	bool doRedraw = _forceRedraw || (_prevForceRedraw && _isDoubleBuf);
-	int actualDirtyRects = _numDirtyRects;
-	if (_isDoubleBuf && _numPrevDirtyRects > 0) {
-		memcpy(_dirtyRectList + _numDirtyRects, _prevDirtyRectList, _numPrevDirtyRects * sizeof(_dirtyRectList[0]));
-		actualDirtyRects += _numPrevDirtyRects;
-	}
+	_dirtyRectList.resize(0);
 
 	// Force a full redraw if requested.
 	// If _useOldSrc, the scaler will do its own partial updates.
 	if (doRedraw) {
-		actualDirtyRects = 1;
-		_dirtyRectList[0].x = 0;
-		_dirtyRectList[0].y = 0;
-		_dirtyRectList[0].w = width;
-		_dirtyRectList[0].h = height;
-	}
+		SDL_Rect r;
+		r.x = 0;
+		r.y = 0;
+		r.w = width;
+		r.h = height;
+		_dirtyRectList.push_back(r);
+	} else if (!_dirtyRegion.isEmpty() || (_isDoubleBuf && !_prevDirtyRegion.isEmpty())) {
+		_updateRegion = _dirtyRegion;
+		if (_isDoubleBuf)
+			_updateRegion.unite(_prevDirtyRegion);
+
+		// Scattered updates are cheaper to scale and blit as a single rectangle
+		_updateRegion.simplify(DIRTY_RECT_COST);
+
+		for (const Common::Rect &rect : _updateRegion) {
+			SDL_Rect r;
+			r.x = rect.left;
+			r.y = rect.top;
+			r.w = rect.width();
+			r.h = rect.height();
+			_dirtyRectList.push_back(r);
+		}
+	}
+	int actualDirtyRects = _dirtyRectList.size();
 
 	_prevForceRedraw = _forceRedraw;
-	if (!_prevForceRedraw && _numDirtyRects && _isDoubleBuf) {
-		memcpy(_prevDirtyRectList, _dirtyRectList, _numDirtyRects * sizeof(_dirtyRectList[0]));
-		_numPrevDirtyRects = _numDirtyRects;
-	}
+	if (!_prevForceRedraw && !_dirtyRegion.isEmpty() && _isDoubleBuf)
+		_prevDirtyRegion = _dirtyRegion;
 
 	// Only draw anything if necessary
 #if SDL_VERSION_ATLEAST(2, 0, 0)
@@ -1443,9 +1461,9 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		SDL_Rect *r;
 		SDL_Rect dst;
 		uint32 bpp, srcPitch, dstPitch;
-		SDL_Rect *lastRect = _dirtyRectList + actualDirtyRects;
+		SDL_Rect *lastRect = _dirtyRectList.data() + actualDirtyRects;
 
-		for (r = _dirtyRectList; r != lastRect; ++r) {
+		for (r = _dirtyRectList.data(); r != lastRect; ++r) {
 			dst = *r;
 			dst.x += _maxExtraPixels;	// Shift rect since some scalers need to access the data around
 			dst.y += _maxExtraPixels;	// any pixel to scale it, and we want to avoid mem access crashes.
@@ -1468,7 +1486,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		srcPitch = srcSurf->pitch;
 		dstPitch = _hwScreen->pitch;
 
-		for (r = _dirtyRectList; r != lastRect; ++r) {
+		for (r = _dirtyRectList.data(); r != lastRect; ++r) {
 			int src_x = r->x;
 			int src_y = r->y;
 			int dst_x = r->x;
@@ -1512,7 +1530,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 				if (_videoMode.aspectRatioCorrection && !_overlayInGUI)
 					dst_y = real2Aspect(dst_y);
 
-				_scaler->scale((byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch, srcPitch,
+				scaleRect((byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch, srcPitch,
 						(byte *)_hwScreen->pixels + dst_x * bpp + dst_y * dstPitch, dstPitch, dst_w, dst_h, src_x, src_y);
 
 				r->x = dst_x;
@@ -1635,7 +1653,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 
 		// Finally, blit all our changes to the screen
 		if (!_displayDisabled) {
-			updateScreen(_dirtyRectList, actualDirtyRects);
+			updateScreen(_dirtyRectList.data(), actualDirtyRects);
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 			doPresent = true;
 #endif
@@ -1646,7 +1664,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	if (_scaler)
 		_scaler->setFactor(oldScaleFactor);
 
-	_numDirtyRects = 0;
+	_dirtyRegion.clear();
 	_forceRedraw = false;
 	_cursorNeedsRedraw = false;
 
@@ -1665,6 +1683,150 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 #endif
 }
 
+void SurfaceSdlGraphicsManager::scaleRect(const byte *src, uint32 srcPitch, byte *dst, uint32 dstPitch, int w, int h, int x, int y) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Scalers comparing against the previous source keep per call state,
+	// and copying at 1x isn't worth the synchronization
+	if (!_useOldSrc && _scaler->getFactor() > 1 && w * h >= kMinParallelScalePixels) {
+		if (_numScalerWorkers < 0)
+			startScalerWorkers();
+
+		int bands = MIN(_numScalerWorkers + 1, h / kMinScalerBandHeight);
+		if (bands > 1) {
+			_scalerJob.src = src;
+			_scalerJob.srcPitch = srcPitch;
+			_scalerJob.dst = dst;
+			_scalerJob.dstPitch = dstPitch;
+			_scalerJob.w = w;
+			_scalerJob.h = h;
+			_scalerJob.x = x;
+			_scalerJob.y = y;
+			_scalerJob.bands = bands;
+
+			for (int i = 0; i < bands - 1; ++i) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+				SDL_SignalSemaphore(_scalerWorkers[i].start);
+#else
+				SDL_SemPost(_scalerWorkers[i].start);
+#endif
+			}
+
+			scaleBand(bands - 1);
+
+			for (int i = 0; i < bands - 1; ++i) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+				SDL_WaitSemaphore(_scalerDone);
+#else
+				SDL_SemWait(_scalerDone);
+#endif
+			}
+			return;
+		}
+	}
+#endif
+
+	_scaler->scale(src, srcPitch, dst, dstPitch, w, h, x, y);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+void SurfaceSdlGraphicsManager::scaleBand(int band) {
+	const ScalerJob &job = _scalerJob;
+	const int top = job.h * band / job.bands;
+	const int bottom = job.h * (band + 1) / job.bands;
+
+	// The scalers read up to extraPixels() rows around the band, which is
+	// fine as the source is not modified while scaling
+	_scaler->scale(job.src + top * job.srcPitch, job.srcPitch,
+	               job.dst + top * _scaler->getFactor() * job.dstPitch, job.dstPitch,
+	               job.w, bottom - top, job.x, job.y + top);
+}
+
+int SDLCALL SurfaceSdlGraphicsManager::scalerWorkerProc(void *data) {
+	ScalerWorker *worker = (ScalerWorker *)data;
+	SurfaceSdlGraphicsManager *manager = worker->manager;
+
+	while (true) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		SDL_WaitSemaphore(worker->start);
+#else
+		SDL_SemWait(worker->start);
+#endif
+		if (manager->_scalerWorkersQuit)
+			break;
+
+		manager->scaleBand(worker->band);
+
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		SDL_SignalSemaphore(manager->_scalerDone);
+#else
+		SDL_SemPost(manager->_scalerDone);
+#endif
+	}
+	return 0;
+}
+
+void SurfaceSdlGraphicsManager::startScalerWorkers() {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	int cpus = SDL_GetNumLogicalCPUCores();
+#else
+	int cpus = SDL_GetCPUCount();
+#endif
+	_numScalerWorkers = 0;
+	_scalerWorkersQuit = false;
+	if (cpus < 2)
+		return;
+
+	_scalerDone = SDL_CreateSemaphore(0);
+	if (!_scalerDone)
+		return;
+
+	const int numWorkers = MIN<int>(cpus, kMaxScalerThreads) - 1;
+	_scalerWorkers = new ScalerWorker[numWorkers];
+	for (int i = 0; i < numWorkers; ++i) {
+		ScalerWorker &worker = _scalerWorkers[i];
+		worker.manager = this;
+		worker.band = i;
+		worker.thread = nullptr;
+		worker.start = SDL_CreateSemaphore(0);
+		if (worker.start)
+			worker.thread = SDL_CreateThread(scalerWorkerProc, "ScummVM scaler", &worker);
+		if (!worker.thread) {
+			// Fall back to the workers started so far
+			if (worker.start)
+				SDL_DestroySemaphore(worker.start);
+			warning("Could not start scaler worker thread: %s", SDL_GetError());
+			break;
+		}
+		_numScalerWorkers++;
+	}
+}
+
+void SurfaceSdlGraphicsManager::stopScalerWorkers() {
+	if (_numScalerWorkers < 0)
+		return;
+
+	_scalerWorkersQuit = true;
+	for (int i = 0; i < _numScalerWorkers; ++i) {
+		ScalerWorker &worker = _scalerWorkers[i];
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		SDL_SignalSemaphore(worker.start);
+#else
+		SDL_SemPost(worker.start);
+#endif
+		SDL_WaitThread(worker.thread, nullptr);
+		SDL_DestroySemaphore(worker.start);
+	}
+	delete[] _scalerWorkers;
+	_scalerWorkers = nullptr;
+	_numScalerWorkers = -1;
+
+	if (_scalerDone) {
+		SDL_DestroySemaphore(_scalerDone);
+		_scalerDone = nullptr;
+	}
+}
+#endif
+
 bool SurfaceSdlGraphicsManager::saveScreenshot(const Common::Path &filename) const {
 	assert(_hwScreen != nullptr);
 
@@ -1865,11 +2027,6 @@ void SurfaceSdlGraphicsManager::addDirtyRect(int x, int y, int w, int h, bool in
 	if (_forceRedraw)
 		return;
 
-	if (_numDirtyRects == NUM_DIRTY_RECT) {
-		_forceRedraw = true;
-		return;
-	}
-
 	int height, width;
 
 	if (!inOverlay && !realCoordinates) {
@@ -1920,14 +2077,8 @@ void SurfaceSdlGraphicsManager::addDirtyRect(int x, int y, int w, int h, bool in
 		return;
 	}
 
-	if (w > 0 && h > 0) {
-		SDL_Rect *r = &_dirtyRectList[_numDirtyRects++];
-
-		r->x = x;
-		r->y = y;
-		r->w = w;
-		r->h = h;
-	}
+	if (w > 0 && h > 0)
+		_dirtyRegion.unite(Common::Rect(x, y, x + w, y + h));
 }
 
 int16 SurfaceSdlGraphicsManager::getHeight() const {
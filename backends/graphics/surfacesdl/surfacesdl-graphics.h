@@ -29,6 +29,7 @@
 #include "graphics/scalerplugin.h"
 #include "common/events.h"
 #include "common/mutex.h"
+#include "common/region.h"
 
 #include "backends/events/sdl/sdl-events.h"
 
@@ -346,25 +347,80 @@ protected:
 	uint _maxExtraPixels;
 	uint _extraPixels;
 
+	/**
+	 * Scale a rect of the game screen with the current scaler.
+	 *
+	 * Large rects are split into horizontal bands, which are scaled by the
+	 * scaler worker threads and the calling thread together. This returns
+	 * once all the bands are done.
+	 */
+	void scaleRect(const byte *src, uint32 srcPitch, byte *dst, uint32 dstPitch, int w, int h, int x, int y);
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	enum {
+		kMaxScalerThreads = 8,            ///< Including the main thread
+		kMinScalerBandHeight = 16,        ///< Source rows per band
+		kMinParallelScalePixels = 128 * 128 ///< Smaller rects are scaled on the main thread
+	};
+
+	struct ScalerWorker {
+		SurfaceSdlGraphicsManager *manager;
+		SDL_Thread *thread;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		SDL_Semaphore *start;
+#else
+		SDL_sem *start;
+#endif
+		int band;
+	};
+
+	/** The rect being scaled in bands */
+	struct ScalerJob {
+		const byte *src;
+		uint32 srcPitch;
+		byte *dst;
+		uint32 dstPitch;
+		int w, h, x, y;
+		int bands;
+	};
+
+	static int SDLCALL scalerWorkerProc(void *data);
+	void startScalerWorkers();
+	void stopScalerWorkers();
+	void scaleBand(int band);
+
+	ScalerWorker *_scalerWorkers;
+	int _numScalerWorkers;   ///< -1 until the workers are started
+	bool _scalerWorkersQuit;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_Semaphore *_scalerDone;
+#else
+	SDL_sem *_scalerDone;
+#endif
+	ScalerJob _scalerJob;
+#endif
+
 	bool _screenIsLocked;
 	Graphics::Surface _framebuffer;
 
 	int _screenChangeCount;
 
 	enum {
-		NUM_DIRTY_RECT = 100,
-		MAX_SCALING = 3
+		MAX_SCALING = 3,
+		// Overhead of updating one more rectangle, in screen pixels. Dirty
+		// areas scattered enough to cost more than their bounds are merged.
+		DIRTY_RECT_COST = 2048
 	};
 
 	// Dirty rect management
+	Common::Region _dirtyRegion;
 	// When double-buffering we need to redraw both updates from
-	// current frame and previous frame. For convenience we copy
-	// them here before traversing the list.
-	SDL_Rect _dirtyRectList[2 * NUM_DIRTY_RECT];
-	int _numDirtyRects;
-
-	SDL_Rect _prevDirtyRectList[NUM_DIRTY_RECT];
-	int _numPrevDirtyRects;
+	// current frame and previous frame.
+	Common::Region _prevDirtyRegion;
+	Common::Region _updateRegion;
+	// The rectangles passed to the scaler and to updateScreen() for
+	// the current update, reused across frames.
+	Common::Array<SDL_Rect> _dirtyRectList;
 
 	struct MousePos {
 		// The size and hotspot of the original cursor image.
@@ -0,0 +1,94 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "backends/imgui/components/imgui_profiler.h"
+
+namespace ImGuiEx {
+
+ImGuiProfiler::ImGuiProfiler() : _historyPos(0), _lastFrame(0) {
+	memset(_frameTimes, 0, sizeof(_frameTimes));
+}
+
+void ImGuiProfiler::drawTrack(const char *label, Common::ProfilerTrack track) {
+	if (!ImGui::CollapsingHeader(label, ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	ProfMan.getLastFrameStats(_stats, track);
+	ImGui::PushID(label);
+	if (ImGui::BeginTable("##stats", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("Scope");
+		ImGui::TableSetupColumn("Calls");
+		ImGui::TableSetupColumn("Time (ms)");
+		ImGui::TableHeadersRow();
+		for (uint i = 0; i < _stats.size(); ++i) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(_stats[i].name);
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", _stats[i].calls);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", _stats[i].total / 1000.f);
+		}
+		ImGui::EndTable();
+	}
+	ImGui::PopID();
+}
+
+void ImGuiProfiler::draw(const char *title, bool *p_open) {
+	if (!*p_open)
+		return;
+
+	ImGui::SetNextWindowSize(ImVec2(420, 480), ImGuiCond_FirstUseEver);
+	if (!ImGui::Begin(title, p_open)) {
+		ImGui::End();
+		return;
+	}
+
+	bool enabled = Common::Profiler::isActive();
+	if (ImGui::Checkbox("Record", &enabled))
+		ProfMan.setEnabled(enabled);
+	ImGui::SameLine();
+	if (ImGui::Button("Reset")) {
+		ProfMan.reset();
+		memset(_frameTimes, 0, sizeof(_frameTimes));
+		_lastFrame = 0;
+	}
+
+	// Sample the frame time once per recorded frame
+	const uint32 frame = ProfMan.getFrameCount();
+	if (frame != _lastFrame && frame > 1) {
+		_frameTimes[_historyPos] = ProfMan.getLastFrameTime() / 1000.f;
+		_historyPos = (_historyPos + 1) % kHistorySize;
+	}
+	_lastFrame = frame;
+
+	const float last = _frameTimes[(_historyPos + kHistorySize - 1) % kHistorySize];
+	char overlay[32];
+	snprintf(overlay, sizeof(overlay), "%.2f ms", last);
+	ImGui::PlotLines("##frames", _frameTimes, kHistorySize, _historyPos, overlay, 0.f, 50.f, ImVec2(-1, 80));
+
+	drawTrack("Main", Common::kProfilerTrackMain);
+	drawTrack("Audio", Common::kProfilerTrackAudio);
+
+	ImGui::End();
+}
+
+} // namespace ImGuiEx
@@ -142,6 +142,13 @@ public:
 	 */
 	void addDefaultInputMapping(const String &hwId);
 
+	/**
+	 * Remove all the default input mappings of the action
+	 */
+	void clearDefaultInputMappings() {
+		_defaultInputMapping.clear();
+	}
+
 	const Array<String> &getDefaultInputMapping() const {
 		return _defaultInputMapping;
 	}
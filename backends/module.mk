@@ -507,6 +507,7 @@ MODULE_OBJS += \
 	imgui/imgui_widgets.o \
 	imgui/imgui_utils.o \
 	imgui/components/imgui_logger.o \
+	imgui/components/imgui_profiler.o \
 	imgui/misc/freetype/imgui_freetype.o
 endif
 
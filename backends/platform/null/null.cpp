@@ -58,6 +58,7 @@ typedef void (*sighandler_t)(int);
 #include "backends/mixer/null/null-mixer.h"
 #include "backends/graphics/null/null-graphics.h"
 #include "gui/debugger.h"
+#include "gui/EventRecorder.h"
 #endif
 
 /*
@@ -86,9 +87,16 @@ public:
 
 	virtual Common::MutexInternal *createMutex();
 	virtual uint32 getMillis(bool skipRecord = false);
+	virtual uint64 getMicros();
 	virtual void delayMillis(uint msecs);
 	virtual void getTimeAndDate(TimeDate &td, bool skipRecord = false) const;
 
+#if defined(ENABLE_EVENTRECORDER) && !defined(NULL_DRIVER_USE_FOR_TEST)
+	virtual MixerManager *getMixerManager();
+	virtual Common::TimerManager *getTimerManager();
+	virtual Common::SaveFileManager *getSavefileManager();
+#endif
+
 	virtual void quit();
 
 	virtual void logMessage(LogMessageType::Type type, const char *message);
@@ -147,13 +155,21 @@ void OSystem_NULL::initBackend() {
 	last_handler = signal(SIGINT, intHandler);
 #endif
 
+#ifndef ENABLE_EVENTRECORDER
 	_timerManager = new DefaultTimerManager();
+#endif
 	_eventManager = new DefaultEventManager(this);
 	_savefileManager = new DefaultSaveFileManager();
 	_graphicsManager = new NullGraphicsManager();
 	_mixerManager = new NullMixerManager();
 	// Setup and start mixer
 	_mixerManager->init();
+
+#ifdef ENABLE_EVENTRECORDER
+	// The event recorder owns the timer manager, and swaps it during playback
+	g_eventRec.registerMixerManager(_mixerManager);
+	g_eventRec.registerTimerManager(new DefaultTimerManager());
+#endif
 #endif
 
 	BaseBackend::initBackend();
@@ -196,16 +212,40 @@ uint32 OSystem_NULL::getMillis(bool skipRecord) {
 
 	gettimeofday(&curTime, 0);
 
-	return (uint32)(((curTime.tv_sec - _startTime.tv_sec) * 1000) +
+	uint32 millis = (uint32)(((curTime.tv_sec - _startTime.tv_sec) * 1000) +
 			((curTime.tv_usec - _startTime.tv_usec) / 1000));
 #elif defined(WIN32)
-	return GetTickCount() - _startTime;
+	uint32 millis = GetTickCount() - _startTime;
 #else
-	return 0;
+	uint32 millis = 0;
+#endif
+
+#if defined(ENABLE_EVENTRECORDER) && !defined(NULL_DRIVER_USE_FOR_TEST)
+	g_eventRec.processMillis(millis, skipRecord);
+#endif
+
+	return millis;
+}
+
+uint64 OSystem_NULL::getMicros() {
+#ifdef POSIX
+	timeval curTime;
+
+	gettimeofday(&curTime, 0);
+
+	return (uint64)(curTime.tv_sec - _startTime.tv_sec) * 1000000 +
+			(curTime.tv_usec - _startTime.tv_usec);
+#else
+	return (uint64)getMillis(true) * 1000;
 #endif
 }
 
 void OSystem_NULL::delayMillis(uint msecs) {
+#if defined(ENABLE_EVENTRECORDER) && !defined(NULL_DRIVER_USE_FOR_TEST)
+	if (g_eventRec.processDelayMillis())
+		return;
+#endif
+
 #ifdef POSIX
 	usleep(msecs * 1000);
 #elif defined(WIN32)
@@ -223,8 +263,27 @@ void OSystem_NULL::getTimeAndDate(TimeDate &td, bool skipRecord) const {
 	td.tm_mon = t.tm_mon;
 	td.tm_year = t.tm_year;
 	td.tm_wday = t.tm_wday;
+
+#if defined(ENABLE_EVENTRECORDER) && !defined(NULL_DRIVER_USE_FOR_TEST)
+	g_eventRec.processTimeAndDate(td, skipRecord);
+#endif
 }
 
+#if defined(ENABLE_EVENTRECORDER) && !defined(NULL_DRIVER_USE_FOR_TEST)
+MixerManager *OSystem_NULL::getMixerManager() {
+	assert(_mixerManager);
+	return g_eventRec.getMixerManager();
+}
+
+Common::TimerManager *OSystem_NULL::getTimerManager() {
+	return g_eventRec.getTimerManager();
+}
+
+Common::SaveFileManager *OSystem_NULL::getSavefileManager() {
+	return g_eventRec.getSaveManager(_savefileManager);
+}
+#endif
+
 #ifndef NULL_DRIVER_USE_FOR_TEST
 void OSystem_NULL::quit() {
 	exit(0);
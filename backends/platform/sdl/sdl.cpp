@@ -850,6 +850,15 @@ uint32 OSystem_SDL::getMillis(bool skipRecord) {
 	return millis;
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+uint64 OSystem_SDL::getMicros() {
+	static const uint64 frequency = SDL_GetPerformanceFrequency();
+	const uint64 counter = SDL_GetPerformanceCounter();
+	// Split the conversion to avoid overflowing with high frequency counters
+	return (counter / frequency) * 1000000 + (counter % frequency) * 1000000 / frequency;
+}
+#endif
+
 void OSystem_SDL::delayMillis(uint msecs) {
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processDelayMillis())
@@ -90,6 +90,9 @@ public:
 	void addSysArchivesToSearchSet(Common::SearchSet &s, int priority = 0) override;
 	Common::MutexInternal *createMutex() override;
 	uint32 getMillis(bool skipRecord = false) override;
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	uint64 getMicros() override;
+#endif
 	void delayMillis(uint msecs) override;
 	void getTimeAndDate(TimeDate &td, bool skipRecord = false) const override;
 	MixerManager *getMixerManager() override;
@@ -122,4 +122,23 @@ POSIXSaveFileManager::POSIXSaveFileManager() {
 	}
 }
 
+bool POSIXSaveFileManager::getSavefileInfo(const Common::String &filename, uint32 &size, uint32 &timestamp) {
+	// Assure the savefile name cache is up-to-date.
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError)
+		return false;
+
+	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
+	if (file == _saveFileCache.end())
+		return false;
+
+	struct stat sb;
+	if (stat(file->_value.getPath().toString(Common::Path::kNativeSeparator).c_str(), &sb) != 0 || !S_ISREG(sb.st_mode))
+		return false;
+
+	size = (uint32)sb.st_size;
+	timestamp = (uint32)sb.st_mtime;
+	return true;
+}
+
 #endif
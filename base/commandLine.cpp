@@ -158,6 +158,8 @@ static const char HELP_STRING4[] =
 	"  --debug-channels-only    Show only the specified debug channels\n"
 	"  -u, --dump-scripts       Enable script dumping if a directory called 'dumps'\n"
 	"                           exists in the current directory\n"
+	"  --profile=FILE           Profile the game and write the recording to FILE,\n"
+	"                           in the Chrome trace JSON format\n"
 	"\n"
 	"  --cdrom=DRIVE            CD drive to play CD audio from; can either be a\n"
 	"                           drive, path, or numeric index (default: 0 = best\n"
@@ -199,8 +201,10 @@ static const char HELP_STRING4[] =
 	"                           atari, macintosh, macintoshbw, vgaGray)\n"
 #ifdef ENABLE_EVENTRECORDER
 	"  --record-mode=MODE       Specify record mode for event recorder (record, playback,\n"
-	"                           info, update, passthrough [default])\n"
+	"                           benchmark, info, update, passthrough [default])\n"
 	"  --record-file-name=FILE  Specify record file name\n"
+	"  --benchmark-report=FILE  Write the JSON report of benchmark playback to FILE\n"
+	"                           instead of the standard output\n"
 	"  --disable-display        Disable any gfx output. Used for headless events\n"
 	"                           playback by Event Recorder\n"
 	"  --screenshot-period=NUM  When recording, trigger a screenshot every NUM milliseconds\n"
@@ -332,6 +336,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("cdrom", 0);
 
 	ConfMan.registerDefault("enable_unsupported_game_warning", true);
+	ConfMan.registerDefault("integrity_stop_on_error", false);
 
 #ifdef USE_FLUIDSYNTH
 	ConfMan.registerDefault("soundfont", "Roland_SC-55.sf2");
@@ -346,6 +351,8 @@ void registerDefaults() {
 	ConfMan.registerDefault("dump_scripts", false);
 	ConfMan.registerDefault("save_slot", -1);
 	ConfMan.registerDefault("autosave_period", 5 * 60); // By default, trigger autosave every 5 minutes
+	ConfMan.registerDefault("rewind_period", 0); // Rewind snapshots are disabled by default
+	ConfMan.registerDefault("rewind_memory", 32); // Memory for the rewind snapshots, in megabytes
 	ConfMan.registerDefault("engine_speed", 60); // FPS limit for 3D games
 
 #if defined(ENABLE_SCUMM) || defined(ENABLE_SWORD2)
@@ -758,6 +765,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_BOOL("debug-channels-only")
 			END_OPTION
 
+			DO_LONG_OPTION("profile")
+			END_OPTION
+
 			DO_OPTION('e', "music-driver")
 			END_OPTION
 
@@ -805,6 +815,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION("record-file-name")
 			END_OPTION
 
+			DO_LONG_OPTION("benchmark-report")
+			END_OPTION
+
 			DO_LONG_COMMAND("list-records")
 			END_COMMAND
 
@@ -42,6 +42,7 @@
 #include "common/debug-channels.h" /* for debug manager */
 #include "common/events.h"
 #include "gui/EventRecorder.h"
+#include "common/file.h"
 #include "common/fs.h"
 #ifdef ENABLE_EVENTRECORDER
 #include "common/recorderfile.h"
@@ -52,6 +53,7 @@
 #include "common/translation.h"
 #include "common/text-to-speech.h"
 #include "common/osd_message_queue.h"
+#include "common/profiler.h"
 
 #include "gui/gui-manager.h"
 #include "gui/error.h"
@@ -178,6 +180,28 @@ void saveLastLaunchedTarget(const Common::String &target) {
 }
 
 // TODO: specify the possible return values here
+/**
+ * Set the default mapping of the global rewind action. Whether rewinding is
+ * enabled depends on the rewind_period of the game, which is not known yet
+ * when the global keymap is built.
+ */
+static void setRewindDefaultMapping(Common::Keymapper *keymapper, bool enabled) {
+	Common::Keymap *globalKeymap = keymapper->getKeymap(Common::kGlobalKeymapName);
+	if (!globalKeymap)
+		return;
+
+	for (Common::Action *action : globalKeymap->getActions()) {
+		if (strcmp(action->id, "REWIND") != 0)
+			continue;
+
+		action->clearDefaultInputMappings();
+		if (enabled)
+			action->addDefaultInputMapping("C+BACKSPACE");
+		keymapper->reloadKeymapMappings(globalKeymap);
+		return;
+	}
+}
+
 static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const DetectedGame &game, const void *meDescriptor) {
 	assert(enginePlugin);
 
@@ -299,6 +323,7 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 	for (auto &gameKeymap : gameKeymaps) {
 		keymapper->addGameKeymap(gameKeymap);
 	}
+	setRewindDefaultMapping(keymapper, ConfMan.getInt("rewind_period") > 0);
 
 	system.applyBackendSettings();
 
@@ -309,9 +334,25 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 	system.getEventManager()->purgeKeyboardEvents();
 	system.getEventManager()->purgeMouseEvents();
 
+	// Record a profile of the game session, if requested
+	const Common::String profileFile = ConfMan.get("profile");
+	if (!profileFile.empty()) {
+		ProfMan.reset();
+		ProfMan.setEnabled(true);
+	}
+
 	// Run the engine
 	Common::Error result = engine->run();
 
+	if (!profileFile.empty()) {
+		ProfMan.setEnabled(false);
+		Common::DumpFile traceFile;
+		if (!traceFile.open(Common::FSNode(Common::Path(profileFile, Common::Path::kNativeSeparator))) ||
+				!ProfMan.writeChromeTrace(traceFile))
+			warning("Could not write the profile to '%s'", profileFile.c_str());
+		traceFile.close();
+	}
+
 	// Make sure we do not return to the launcher if this is not possible.
 	if (!engine->hasFeature(Engine::kSupportsReturnToLauncher))
 		ConfMan.setBool("gui_return_to_launcher_at_exit", false, Common::ConfigManager::kTransientDomain);
@@ -321,6 +362,7 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 
 	// Clean up any game-specific keymaps
 	keymapper->cleanupGameKeymaps();
+	setRewindDefaultMapping(keymapper, false);
 
 	// Free up memory
 	metaEngine.deleteInstance(engine, game, meDescriptor);
@@ -782,6 +824,8 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderUpdate);
 			} else if (recordMode == "playback") {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
+			} else if (recordMode == "benchmark") {
+				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback, true);
 			} else if ((recordMode == "info") && (!recordFileName.empty())) {
 				Common::PlaybackFile record;
 				record.openRead(recordFileName);
@@ -123,6 +123,10 @@ SeekableReadStream *Archive::createReadStreamForMemberAltStream(const Path &path
 	return nullptr;
 }
 
+bool Archive::getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const {
+	return false;
+}
+
 Common::Error Archive::dumpArchive(const Path &destPath) {
 	Common::ArchiveMemberList files;
 
@@ -595,6 +599,30 @@ SeekableReadStream *SearchSet::createReadStreamForMemberAltStream(const Path &pa
 	return nullptr;
 }
 
+bool SearchSet::getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const {
+	if (path.empty())
+		return false;
+
+	for (const auto &archive : _list) {
+		if (archive._arc->hasFile(path))
+			return archive._arc->getMemberInfo(path, size, crc);
+	}
+
+	return false;
+}
+
+String SearchSet::getArchiveNameForMember(const Path &path) const {
+	if (path.empty())
+		return String();
+
+	for (const auto &archive : _list) {
+		if (archive._arc->hasFile(path))
+			return archive._name;
+	}
+
+	return String();
+}
+
 SeekableReadStream *SearchSet::createReadStreamForMemberNext(const Path &path, const Archive *starting) const {
 	if (path.empty())
 		return nullptr;
@@ -196,6 +196,14 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, AltStreamType altStreamType) const;
 
+	/**
+	 * Get the size and the CRC-32 checksum of a member, as recorded in the
+	 * directory of the archive, without reading the member.
+	 *
+	 * @return true if the archive records them, as zip archives do.
+	 */
+	virtual bool getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const;
+
 	/**
 	 * For most archives: same as previous. For SearchSet see SearchSet
 	 * documentation.
@@ -465,6 +473,18 @@ public:
 	 */
 	SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, AltStreamType altStreamType) const override;
 
+	/**
+	 * Get the size and the CRC-32 checksum of a member from the archive
+	 * it would be read from, i.e. the one with the highest priority.
+	 */
+	bool getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const override;
+
+	/**
+	 * Get the name of the archive a member would be read from, i.e. the
+	 * one with the highest priority. Empty if no archive contains it.
+	 */
+	String getArchiveNameForMember(const Path &path) const;
+
 	/**
 	 * Similar to above but exclude matches from archives before starting and starting itself.
 	 */
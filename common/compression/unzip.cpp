@@ -1045,6 +1045,7 @@ public:
 	bool isPathDirectory(const Path &path) const override;
 	int listMembers(ArchiveMemberList &list) const override;
 	const ArchiveMemberPtr getMember(const Path &path) const override;
+	bool getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const override;
 	Common::SharedArchiveContents readContentsForPath(const Common::Path &translated) const override;
 	Common::Path translatePath(const Common::Path &path) const override {
 		return _flattenTree ? path.getLastComponent() : path;
@@ -1111,6 +1112,19 @@ const ArchiveMemberPtr ZipArchive::getMember(const Path &path) const {
 	return ArchiveMemberPtr(new GenericArchiveMember(path, *this));
 }
 
+bool ZipArchive::getMemberInfo(const Path &path, uint32 &size, uint32 &crc) const {
+	if (unzLocateFile(_zipFile, path, 2) != UNZ_OK)
+		return false;
+
+	unz_file_info fi;
+	if (unzGetCurrentFileInfo(_zipFile, &fi, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK)
+		return false;
+
+	size = fi.uncompressed_size;
+	crc = fi.crc;
+	return true;
+}
+
 Common::SharedArchiveContents ZipArchive::readContentsForPath(const Common::Path &path) const {
 	if (unzLocateFile(_zipFile, path, 2) != UNZ_OK)
 		return Common::SharedArchiveContents();
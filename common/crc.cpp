@@ -0,0 +1,84 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/crc.h"
+#include "common/endian.h"
+
+namespace Common {
+
+namespace {
+
+struct CRC32SliceTables {
+	uint32 slices[8][256];
+
+	CRC32SliceTables() {
+		const CRCReflected<uint32> crc(0xEDB88320, 0xFFFFFFFF, 0xFFFFFFFF);
+
+		for (int i = 0; i < 256; ++i)
+			slices[0][i] = crc.processByte(0, i);
+
+		for (int n = 1; n < 8; ++n) {
+			for (int i = 0; i < 256; ++i)
+				slices[n][i] = (slices[n - 1][i] >> 8) ^ slices[0][slices[n - 1][i] & 0xFF];
+		}
+	}
+};
+
+} // End of anonymous namespace
+
+static const uint32 (*getCRC32SliceTables())[256] {
+	static const CRC32SliceTables tables;
+	return tables.slices;
+}
+
+CRC32::CRC32() : CRCReflected<uint32>(0xEDB88320, 0xFFFFFFFF, 0xFFFFFFFF), _slices(getCRC32SliceTables()) {
+}
+
+uint32 CRC32::crcFast(byte const message[], int nBytes) const {
+	return finalize(processBlock(message, nBytes, getInitRemainder()));
+}
+
+uint32 CRC32::processBlock(byte const message[], uint32 nBytes, uint32 remainder) const {
+	/*
+	 * Divide the message by the polynomial, 8 bytes at a time. The
+	 * little endian reads make the remainder line up with the bytes on
+	 * all hosts.
+	 */
+	while (nBytes >= 8) {
+		const uint32 one = READ_LE_UINT32(message) ^ remainder;
+		const uint32 two = READ_LE_UINT32(message + 4);
+
+		remainder = _slices[7][one & 0xFF] ^ _slices[6][(one >> 8) & 0xFF] ^
+		            _slices[5][(one >> 16) & 0xFF] ^ _slices[4][one >> 24] ^
+		            _slices[3][two & 0xFF] ^ _slices[2][(two >> 8) & 0xFF] ^
+		            _slices[1][(two >> 16) & 0xFF] ^ _slices[0][two >> 24];
+
+		message += 8;
+		nBytes -= 8;
+	}
+
+	while (nBytes--)
+		remainder = _slices[0][(*message++ ^ remainder) & 0xFF] ^ (remainder >> 8);
+
+	return remainder;
+}
+
+} // End of namespace Common
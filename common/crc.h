@@ -230,7 +230,25 @@ public:
 
 class CRC32 : public CRCReflected<uint32> {
 public:
-	CRC32() : CRCReflected<uint32>(0xEDB88320, 0xFFFFFFFF, 0xFFFFFFFF) {}
+	CRC32();
+
+	/**
+	 * Compute the CRC of a given message, 8 bytes at a time.
+	 */
+	uint32 crcFast(byte const message[], int nBytes) const;
+
+	/**
+	 * Update a running CRC with a block of data, 8 bytes at a time.
+	 * Equivalent to calling processByte() for each byte of the block.
+	 */
+	uint32 processBlock(byte const message[], uint32 nBytes, uint32 remainder) const;
+
+private:
+	/*
+	 * Slicing-by-8 tables, shared by all the instances: _slices[n][i] is the
+	 * remainder of byte i followed by n zero bytes.
+	 */
+	const uint32 (*_slices)[256];
 };
 
 } // End of namespace Common
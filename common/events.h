@@ -117,6 +117,9 @@ enum EventType {
 	EVENT_FOCUS_GAINED = 36,
 	EVENT_FOCUS_LOST = 37,
 
+	/** Restore the last rewind snapshot of the running engine. */
+	EVENT_REWIND = 38,
+
 	/**
 	 * We reserve some event ids for custom events.
 	 * 
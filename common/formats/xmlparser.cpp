@@ -24,6 +24,7 @@
 #include "common/fs.h"
 #include "common/memstream.h"
 #include "common/system.h"
+#include "common/stream.h"
 
 namespace Common {
 
@@ -78,6 +79,13 @@ void XMLParser::close() {
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
+	// There is no text to show around the error in the compiled format
+	if (_compiledInput) {
+		Common::String errorMessage = Common::String::format("\n  File <%s>:\n\nParser error: %s\n\n", _fileName.toString().c_str(), errStr.c_str());
+		g_system->logMessage(LogMessageType::kError, errorMessage.c_str());
+		return false;
+	}
+
 	const int startPosition = _stream->pos();
 	int currentPosition = startPosition;
 	int lineCount = 1;
@@ -157,6 +165,9 @@ bool XMLParser::parseActiveKey(bool closed) {
 
 	ParserNode *key = _activeKey.top();
 
+	if (_compiledOutput)
+		writeCompiledKey(key, closed);
+
 	if (key->name == "xml" && key->header == true) {
 		assert(closed);
 		return parseXMLHeader(key) && closeKey();
@@ -351,6 +362,11 @@ bool XMLParser::parse() {
 						parserError("Unexpected end of file.");
 						break;
 					}
+					if (_compiledOutput) {
+						_compiledOutput->writeByte(kCompiledText);
+						_compiledOutput->writeString(text);
+						_compiledOutput->writeByte(0);
+					}
 					if (!textCallback(text)) {
 						parserError("Failed to process text segment.");
 						break;
@@ -411,6 +427,9 @@ bool XMLParser::parse() {
 
 		case kParserNeedPropertyName:
 			if (activeClosure) {
+				if (_compiledOutput)
+					_compiledOutput->writeByte(kCompiledKeyClose);
+
 				if (!closeKey()) {
 					parserError("Missing data when closing key '" + _activeKey.top()->name + "'.");
 					break;
@@ -486,6 +505,92 @@ bool XMLParser::parse() {
 	return true;
 }
 
+void XMLParser::writeCompiledKey(const ParserNode *node, bool closed) {
+	if (node->header)
+		_compiledOutput->writeByte(kCompiledHeader);
+	else
+		_compiledOutput->writeByte(closed ? kCompiledKeyClosed : kCompiledKeyOpen);
+	_compiledOutput->writeString(node->name);
+	_compiledOutput->writeByte(0);
+
+	_compiledOutput->writeUint16LE(node->values.size());
+	for (const auto &value : node->values) {
+		_compiledOutput->writeString(value._key);
+		_compiledOutput->writeByte(0);
+		_compiledOutput->writeString(value._value);
+		_compiledOutput->writeByte(0);
+	}
+}
+
+bool XMLParser::parseCompiled() {
+	if (_stream == nullptr)
+		return false;
+
+	_stream->seek(0, SEEK_SET);
+
+	if (_XMLkeys == nullptr)
+		buildLayout();
+
+	while (!_activeKey.empty())
+		freeNode(_activeKey.pop());
+
+	cleanup();
+
+	_state = kParserNeedKey;
+	_compiledInput = true;
+
+	while (_state != kParserError) {
+		const byte type = _stream->readByte();
+		if (_stream->eos())
+			break;
+
+		switch (type) {
+		case kCompiledHeader:
+		case kCompiledKeyOpen:
+		case kCompiledKeyClosed: {
+			ParserNode *node = allocNode();
+			node->name = _stream->readString();
+			node->ignore = false;
+			node->header = (type == kCompiledHeader);
+			node->depth = _activeKey.size();
+			node->layout = nullptr;
+
+			const uint16 count = _stream->readUint16LE();
+			for (uint16 i = 0; i < count; ++i) {
+				const String name = _stream->readString();
+				node->values[name] = _stream->readString();
+			}
+
+			_activeKey.push(node);
+			parseActiveKey(type != kCompiledKeyOpen);
+			break;
+		}
+
+		case kCompiledKeyClose:
+			if (_activeKey.empty())
+				parserError("Unexpected closure.");
+			else if (!closeKey())
+				parserError("Missing data when closing key.");
+			break;
+
+		case kCompiledText:
+			if (!textCallback(_stream->readString()))
+				parserError("Failed to process text segment.");
+			break;
+
+		default:
+			parserError("Invalid compiled data.");
+			break;
+		}
+	}
+
+	if (_state != kParserError && (_stream->err() || !_activeKey.empty()))
+		parserError("Unexpected end of file.");
+
+	_compiledInput = false;
+	return _state != kParserError;
+}
+
 bool XMLParser::skipSpaces() {
 	if (!isSpace(_char))
 		return false;
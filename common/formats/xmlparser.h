@@ -45,6 +45,7 @@ namespace Common {
  */
 
 class SeekableReadStream;
+class WriteStream;
 
 #define MAX_XML_DEPTH 8
 
@@ -100,7 +101,8 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(nullptr), _stream(nullptr), _allowText(false), _char(0) {}
+	XMLParser() : _XMLkeys(nullptr), _stream(nullptr), _allowText(false), _char(0),
+		_compiledOutput(nullptr), _compiledInput(false) {}
 
 	virtual ~XMLParser();
 
@@ -195,6 +197,22 @@ public:
 	 */
 	bool parse();
 
+	/**
+	 * Record the keys found by parse() to the given stream, in a compact
+	 * binary form which parseCompiled() loads much faster than the XML text.
+	 * Pass nullptr to stop recording. The stream is not owned by the parser.
+	 */
+	void setCompiledOutput(WriteStream *stream) {
+		_compiledOutput = stream;
+	}
+
+	/**
+	 * Parses the loaded data stream, which must have been recorded by
+	 * parse() with setCompiledOutput(). The same callbacks are issued
+	 * as when parsing the original XML data.
+	 */
+	bool parseCompiled();
+
 	/**
 	 * Returns the active node being parsed (the one on top of
 	 * the node stack).
@@ -355,6 +373,8 @@ protected:
 
 	bool parseXMLHeader(ParserNode *node);
 
+	void writeCompiledKey(const ParserNode *node, bool closed);
+
 	/**
 	 * Overload if your parser needs to support parsing the same file
 	 * several times, so you can clean up the internal state of the
@@ -385,6 +405,18 @@ private:
 	String _token; /** Current text token */
 
 	Stack<ParserNode *> _activeKey; /** Node stack of the parsed keys */
+
+	/** Record types of the compiled format */
+	enum {
+		kCompiledKeyOpen = 1,
+		kCompiledKeyClosed = 2, /** Self-closed key */
+		kCompiledKeyClose = 3,
+		kCompiledText = 4,
+		kCompiledHeader = 5
+	};
+
+	WriteStream *_compiledOutput; /** Where to record the parsed keys, if anywhere */
+	bool _compiledInput; /** Whether the compiled format is being parsed */
 };
 
 /** @} */
@@ -151,21 +151,27 @@ uint32 MacResManager::getResForkDataSize() const {
 	return _stream->readUint32BE();
 }
 
-String MacResManager::computeResForkMD5AsString(uint32 length, bool tail, ProgressUpdateCallback progressUpdateCallback, void *callbackParameter) const {
+SeekableReadStream *MacResManager::openResForkData() const {
 	if (!hasResFork())
-		return String();
+		return nullptr;
 
 	_stream->seek(_resForkOffset);
 	uint32 dataOffset = _stream->readUint32BE() + _resForkOffset;
 	/* uint32 mapOffset = */ _stream->readUint32BE();
 	uint32 dataLength = _stream->readUint32BE();
 
+	return new SeekableSubReadStream(_stream, dataOffset, dataOffset + dataLength);
+}
+
+String MacResManager::computeResForkMD5AsString(uint32 length, bool tail, ProgressUpdateCallback progressUpdateCallback, void *callbackParameter) const {
+	ScopedPtr<SeekableReadStream> resForkStream(openResForkData());
+	if (!resForkStream)
+		return String();
 
-	SeekableSubReadStream resForkStream(_stream, dataOffset, dataOffset + dataLength);
-	if (tail && dataLength > length)
-		resForkStream.seek(-(int64)length, SEEK_END);
+	if (tail && resForkStream->size() > length)
+		resForkStream->seek(-(int64)length, SEEK_END);
 
-	return computeStreamMD5AsString(resForkStream, MIN<uint32>(length, _resForkSize), progressUpdateCallback, callbackParameter);
+	return computeStreamMD5AsString(*resForkStream, MIN<uint32>(length, _resForkSize), progressUpdateCallback, callbackParameter);
 }
 
 
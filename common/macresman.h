@@ -281,6 +281,12 @@ public:
 		return _dataLength;
 	}
 
+	/**
+	 * Open the data portion of the resource fork
+	 * @return The stream, which reads from this resource manager and must be deleted before it is closed
+	 */
+	SeekableReadStream *openResForkData() const;
+
 	/**
 	 * Calculate the MD5 checksum of the resource fork
 	 * @param length The maximum length to compute for
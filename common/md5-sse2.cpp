@@ -0,0 +1,195 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Common {
+
+// Same rounds as md5_process() in md5.cpp, with a checksum in each lane
+
+#define S(x, n) _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n))
+
+#define P(a, b, c, d, k, s, t)                                                                  \
+{                                                                                               \
+	a = _mm_add_epi32(a, _mm_add_epi32(F(b,c,d), _mm_add_epi32(X[k], _mm_set1_epi32((int)t)))); \
+	a = _mm_add_epi32(S(a,s), b);                                                              \
+}
+
+void md5_process_x4_sse2(uint32 *const states[4], const uint8 *const data[4], uint32 blockCount) {
+	__m128i X[16], A, B, C, D;
+
+	A = _mm_set_epi32(states[3][0], states[2][0], states[1][0], states[0][0]);
+	B = _mm_set_epi32(states[3][1], states[2][1], states[1][1], states[0][1]);
+	C = _mm_set_epi32(states[3][2], states[2][2], states[1][2], states[0][2]);
+	D = _mm_set_epi32(states[3][3], states[2][3], states[1][3], states[0][3]);
+
+	const __m128i ones = _mm_set1_epi32(-1);
+
+	for (uint32 offset = 0; offset < blockCount * 64; offset += 64) {
+		// Transpose the blocks, so that each vector holds the same word of the four blocks
+		for (int k = 0; k < 16; k += 4) {
+			const __m128i r0 = _mm_loadu_si128((const __m128i *)(data[0] + offset + 4 * k));
+			const __m128i r1 = _mm_loadu_si128((const __m128i *)(data[1] + offset + 4 * k));
+			const __m128i r2 = _mm_loadu_si128((const __m128i *)(data[2] + offset + 4 * k));
+			const __m128i r3 = _mm_loadu_si128((const __m128i *)(data[3] + offset + 4 * k));
+
+			const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+			const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+			const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+			const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+			X[k]     = _mm_unpacklo_epi64(t0, t1);
+			X[k + 1] = _mm_unpackhi_epi64(t0, t1);
+			X[k + 2] = _mm_unpacklo_epi64(t2, t3);
+			X[k + 3] = _mm_unpackhi_epi64(t2, t3);
+		}
+
+		const __m128i AA = A, BB = B, CC = C, DD = D;
+
+#define F(x, y, z) _mm_xor_si128(z, _mm_and_si128(x, _mm_xor_si128(y, z)))
+
+		P(A, B, C, D,  0,  7, 0xD76AA478);
+		P(D, A, B, C,  1, 12, 0xE8C7B756);
+		P(C, D, A, B,  2, 17, 0x242070DB);
+		P(B, C, D, A,  3, 22, 0xC1BDCEEE);
+		P(A, B, C, D,  4,  7, 0xF57C0FAF);
+		P(D, A, B, C,  5, 12, 0x4787C62A);
+		P(C, D, A, B,  6, 17, 0xA8304613);
+		P(B, C, D, A,  7, 22, 0xFD469501);
+		P(A, B, C, D,  8,  7, 0x698098D8);
+		P(D, A, B, C,  9, 12, 0x8B44F7AF);
+		P(C, D, A, B, 10, 17, 0xFFFF5BB1);
+		P(B, C, D, A, 11, 22, 0x895CD7BE);
+		P(A, B, C, D, 12,  7, 0x6B901122);
+		P(D, A, B, C, 13, 12, 0xFD987193);
+		P(C, D, A, B, 14, 17, 0xA679438E);
+		P(B, C, D, A, 15, 22, 0x49B40821);
+
+#undef F
+
+#define F(x, y, z) _mm_xor_si128(y, _mm_and_si128(z, _mm_xor_si128(x, y)))
+
+		P(A, B, C, D,  1,  5, 0xF61E2562);
+		P(D, A, B, C,  6,  9, 0xC040B340);
+		P(C, D, A, B, 11, 14, 0x265E5A51);
+		P(B, C, D, A,  0, 20, 0xE9B6C7AA);
+		P(A, B, C, D,  5,  5, 0xD62F105D);
+		P(D, A, B, C, 10,  9, 0x02441453);
+		P(C, D, A, B, 15, 14, 0xD8A1E681);
+		P(B, C, D, A,  4, 20, 0xE7D3FBC8);
+		P(A, B, C, D,  9,  5, 0x21E1CDE6);
+		P(D, A, B, C, 14,  9, 0xC33707D6);
+		P(C, D, A, B,  3, 14, 0xF4D50D87);
+		P(B, C, D, A,  8, 20, 0x455A14ED);
+		P(A, B, C, D, 13,  5, 0xA9E3E905);
+		P(D, A, B, C,  2,  9, 0xFCEFA3F8);
+		P(C, D, A, B,  7, 14, 0x676F02D9);
+		P(B, C, D, A, 12, 20, 0x8D2A4C8A);
+
+#undef F
+
+#define F(x, y, z) _mm_xor_si128(x, _mm_xor_si128(y, z))
+
+		P(A, B, C, D,  5,  4, 0xFFFA3942);
+		P(D, A, B, C,  8, 11, 0x8771F681);
+		P(C, D, A, B, 11, 16, 0x6D9D6122);
+		P(B, C, D, A, 14, 23, 0xFDE5380C);
+		P(A, B, C, D,  1,  4, 0xA4BEEA44);
+		P(D, A, B, C,  4, 11, 0x4BDECFA9);
+		P(C, D, A, B,  7, 16, 0xF6BB4B60);
+		P(B, C, D, A, 10, 23, 0xBEBFBC70);
+		P(A, B, C, D, 13,  4, 0x289B7EC6);
+		P(D, A, B, C,  0, 11, 0xEAA127FA);
+		P(C, D, A, B,  3, 16, 0xD4EF3085);
+		P(B, C, D, A,  6, 23, 0x04881D05);
+		P(A, B, C, D,  9,  4, 0xD9D4D039);
+		P(D, A, B, C, 12, 11, 0xE6DB99E5);
+		P(C, D, A, B, 15, 16, 0x1FA27CF8);
+		P(B, C, D, A,  2, 23, 0xC4AC5665);
+
+#undef F
+
+#define F(x, y, z) _mm_xor_si128(y, _mm_or_si128(x, _mm_xor_si128(z, ones)))
+
+		P(A, B, C, D,  0,  6, 0xF4292244);
+		P(D, A, B, C,  7, 10, 0x432AFF97);
+		P(C, D, A, B, 14, 15, 0xAB9423A7);
+		P(B, C, D, A,  5, 21, 0xFC93A039);
+		P(A, B, C, D, 12,  6, 0x655B59C3);
+		P(D, A, B, C,  3, 10, 0x8F0CCC92);
+		P(C, D, A, B, 10, 15, 0xFFEFF47D);
+		P(B, C, D, A,  1, 21, 0x85845DD1);
+		P(A, B, C, D,  8,  6, 0x6FA87E4F);
+		P(D, A, B, C, 15, 10, 0xFE2CE6E0);
+		P(C, D, A, B,  6, 15, 0xA3014314);
+		P(B, C, D, A, 13, 21, 0x4E0811A1);
+		P(A, B, C, D,  4,  6, 0xF7537E82);
+		P(D, A, B, C, 11, 10, 0xBD3AF235);
+		P(C, D, A, B,  2, 15, 0x2AD7D2BB);
+		P(B, C, D, A,  9, 21, 0xEB86D391);
+
+#undef F
+
+		A = _mm_add_epi32(A, AA);
+		B = _mm_add_epi32(B, BB);
+		C = _mm_add_epi32(C, CC);
+		D = _mm_add_epi32(D, DD);
+	}
+
+	uint32 result[4][4];
+	_mm_storeu_si128((__m128i *)result[0], A);
+	_mm_storeu_si128((__m128i *)result[1], B);
+	_mm_storeu_si128((__m128i *)result[2], C);
+	_mm_storeu_si128((__m128i *)result[3], D);
+
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++)
+			states[i][j] = result[j][i];
+	}
+}
+
+#undef P
+#undef S
+
+} // End of namespace Common
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
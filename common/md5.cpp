@@ -26,37 +26,18 @@
  */
 
 #include "common/md5.h"
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/str.h"
 #include "common/stream.h"
+#include "common/system.h"
 
 namespace Common {
 
-struct md5_context {
-	uint32 total[2];
-	uint32 state[4];
-	uint8 buffer[64];
-};
-
-static void md5_starts(md5_context *ctx);
-static void md5_update(md5_context *ctx, const uint8 *input, uint32 length);
-static void md5_finish(md5_context *ctx, uint8 digest[16]);
-
-
 #define GET_UINT32(n, b, i)	(n) = READ_LE_UINT32(b + i)
 #define PUT_UINT32(n, b, i)	WRITE_LE_UINT32(b + i, n)
 
-void md5_starts(md5_context *ctx) {
-	ctx->total[0] = 0;
-	ctx->total[1] = 0;
-
-	ctx->state[0] = 0x67452301;
-	ctx->state[1] = 0xEFCDAB89;
-	ctx->state[2] = 0x98BADCFE;
-	ctx->state[3] = 0x10325476;
-}
-
-static void md5_process(md5_context *ctx, const uint8 data[64]) {
+static void md5_process(uint32 state[4], const uint8 data[64]) {
 	uint32 X[16], A, B, C, D;
 
 	GET_UINT32(X[0],  data,  0);
@@ -83,10 +64,10 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 	a += F(b,c,d) + X[k] + t; a = S(a,s) + b; \
 }
 
-	A = ctx->state[0];
-	B = ctx->state[1];
-	C = ctx->state[2];
-	D = ctx->state[3];
+	A = state[0];
+	B = state[1];
+	C = state[2];
+	D = state[3];
 
 #define F(x, y, z) (z ^ (x & (y ^ z)))
 
@@ -172,46 +153,130 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 
 #undef F
 
-	ctx->state[0] += A;
-	ctx->state[1] += B;
-	ctx->state[2] += C;
-	ctx->state[3] += D;
+	state[0] += A;
+	state[1] += B;
+	state[2] += C;
+	state[3] += D;
+}
+
+#undef P
+#undef S
+
+// Process blockCount blocks for each of four checksums
+typedef void (*ProcessX4Func)(uint32 *const states[4], const uint8 *const data[4], uint32 blockCount);
+
+#ifdef SCUMMVM_SSE2
+// Defined in md5-sse2.cpp
+void md5_process_x4_sse2(uint32 *const states[4], const uint8 *const data[4], uint32 blockCount);
+#endif
+
+static void md5_process_x4_generic(uint32 *const states[4], const uint8 *const data[4], uint32 blockCount) {
+	for (int i = 0; i < 4; i++) {
+		for (uint32 j = 0; j < blockCount; j++)
+			md5_process(states[i], data[i] + j * 64);
+	}
 }
 
-void md5_update(md5_context *ctx, const uint8 *input, uint32 length) {
+static ProcessX4Func md5_get_process_x4() {
+#ifdef SCUMMVM_SSE2
+#if defined(__x86_64__) || defined(_M_X64)
+	// SSE2 is part of x86-64
+	return md5_process_x4_sse2;
+#else
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		return md5_process_x4_sse2;
+#endif
+#endif
+	return md5_process_x4_generic;
+}
+
+// Size of the reads from the streams, a multiple of the block size
+static const uint32 kMD5ReadSize = 64 * 1024;
+
+// Size of the reads when several streams are hashed, for each stream
+static const uint32 kMD5MultiReadSize = 16 * 1024;
+
+// Number of checksums processed together by the SIMD implementations
+static const uint kMD5Lanes = 4;
+
+MD5::MD5() {
+	reset();
+}
+
+void MD5::reset() {
+	_total[0] = 0;
+	_total[1] = 0;
+
+	_state[0] = 0x67452301;
+	_state[1] = 0xEFCDAB89;
+	_state[2] = 0x98BADCFE;
+	_state[3] = 0x10325476;
+}
+
+void MD5::addLength(uint32 length) {
+	_total[0] += length;
+	_total[0] &= 0xFFFFFFFF;
+
+	if (_total[0] < length)
+		_total[1]++;
+}
+
+void MD5::update(const byte *input, uint32 length) {
 	uint32 left, fill;
 
 	if (!length)
 		return;
 
-	left = ctx->total[0] & 0x3F;
+	left = _total[0] & 0x3F;
 	fill = 64 - left;
 
-	ctx->total[0] += length;
-	ctx->total[0] &= 0xFFFFFFFF;
-
-	if (ctx->total[0] < length)
-		ctx->total[1]++;
+	addLength(length);
 
 	if (left && length >= fill) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, fill);
-		md5_process(ctx, ctx->buffer);
+		memcpy((void *)(_buffer + left), (const void *)input, fill);
+		md5_process(_state, _buffer);
 		length -= fill;
 		input  += fill;
 		left = 0;
 	}
 
 	while (length >= 64) {
-		md5_process(ctx, input);
+		md5_process(_state, input);
 		length -= 64;
 		input  += 64;
 	}
 
 	if (length) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, length);
+		memcpy((void *)(_buffer + left), (const void *)input, length);
 	}
 }
 
+void MD5::updateMulti(MD5 *const md5s[], const byte *const data[], uint count, uint32 size) {
+	static const ProcessX4Func processX4 = md5_get_process_x4();
+
+	// Process the whole blocks of four checksums at a time, as long as none
+	// of them has buffered data
+	const uint32 blockCount = size / 64;
+	uint first = 0;
+
+	for (; blockCount && first + kMD5Lanes <= count; first += kMD5Lanes) {
+		MD5 *const *group = md5s + first;
+		if ((group[0]->_total[0] | group[1]->_total[0] | group[2]->_total[0] | group[3]->_total[0]) & 0x3F)
+			break;
+
+		uint32 *const states[4] = { group[0]->_state, group[1]->_state, group[2]->_state, group[3]->_state };
+		processX4(states, data + first, blockCount);
+
+		for (uint j = 0; j < kMD5Lanes; j++) {
+			group[j]->addLength(blockCount * 64);
+			group[j]->update(data[first + j] + blockCount * 64, size - blockCount * 64);
+		}
+	}
+
+	for (uint i = first; i < count; i++)
+		md5s[i]->update(data[i], size);
+}
+
 static const uint8 md5_padding[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -219,67 +284,159 @@ static const uint8 md5_padding[64] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
-void md5_finish(md5_context *ctx, uint8 digest[16]) {
+void MD5::getDigest(uint8 digest[16]) const {
 	uint32 last, padn;
 	uint32 high, low;
 	uint8 msglen[8];
 
-	high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
-	low  = (ctx->total[0] <<  3);
+	// Pad a copy, so that more data can be added to this one
+	MD5 ctx(*this);
+
+	high = (ctx._total[0] >> 29) | (ctx._total[1] << 3);
+	low  = (ctx._total[0] <<  3);
 
 	PUT_UINT32(low,  msglen, 0);
 	PUT_UINT32(high, msglen, 4);
 
-	last = ctx->total[0] & 0x3F;
+	last = ctx._total[0] & 0x3F;
 	padn = (last < 56) ? (56 - last) : (120 - last);
 
-	md5_update(ctx, md5_padding, padn);
-	md5_update(ctx, msglen, 8);
+	ctx.update(md5_padding, padn);
+	ctx.update(msglen, 8);
 
-	PUT_UINT32(ctx->state[0], digest,  0);
-	PUT_UINT32(ctx->state[1], digest,  4);
-	PUT_UINT32(ctx->state[2], digest,  8);
-	PUT_UINT32(ctx->state[3], digest, 12);
+	PUT_UINT32(ctx._state[0], digest,  0);
+	PUT_UINT32(ctx._state[1], digest,  4);
+	PUT_UINT32(ctx._state[2], digest,  8);
+	PUT_UINT32(ctx._state[3], digest, 12);
 }
 
+String MD5::getDigestAsString() const {
+	uint8 digest[16];
+	getDigest(digest);
+
+	String md5;
+	for (int i = 0; i < 16; i++) {
+		md5 += String::format("%02x", (int)digest[i]);
+	}
+	return md5;
+}
 
 bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, ProgressUpdateCallback progressUpdateCallback, void *callbackParameter) {
 
 #ifdef DISABLE_MD5
 	memset(digest, 0, 16);
 #else
-	md5_context ctx;
+	MD5 md5;
 	int i;
-	unsigned char buf[1000];
 	bool restricted = (length != 0);
 	uint32 readlen;
 
-	if (!restricted || sizeof(buf) <= length)
-		readlen = sizeof(buf);
+	if (!restricted || kMD5ReadSize <= length)
+		readlen = kMD5ReadSize;
 	else
 		readlen = length;
 
-	md5_starts(&ctx);
+	Array<byte> buf(readlen);
 
-	while ((i = stream.read(buf, readlen)) > 0) {
+	while ((i = stream.read(buf.data(), readlen)) > 0) {
 
 		if (progressUpdateCallback != nullptr && !progressUpdateCallback(callbackParameter, i)) {
 			return false;
 		}
 
-		md5_update(&ctx, buf, i);
+		md5.update(buf.data(), i);
 
 		if (restricted) {
 			length -= i;
 			if (length == 0)
 				break;
 
-			if (sizeof(buf) > length)
+			if (readlen > length)
 				readlen = length;
 		}
 	}
 
-	md5_finish(&ctx, digest);
+	md5.getDigest(digest);
+#endif
+	return true;
+}
+
+bool computeStreamsMD5(ReadStream *const streams[], uint count, uint8 (*digests)[16], uint32 length, ProgressUpdateCallback progressUpdateCallback, void *callbackParameter) {
+
+#ifdef DISABLE_MD5
+	memset(digests, 0, count * 16);
+#else
+	// Each lane hashes a stream, and takes the next one when it is done,
+	// so that the lanes are kept busy until the last streams
+	struct Lane {
+		int stream;
+		uint32 left;
+		byte *buffer;
+	};
+
+	Array<byte> buffers(kMD5Lanes * kMD5MultiReadSize);
+	Array<MD5> md5s(count);
+	Lane lanes[kMD5Lanes];
+	uint next = 0;
+
+	for (uint i = 0; i < kMD5Lanes; i++) {
+		lanes[i].stream = -1;
+		lanes[i].left = 0;
+		lanes[i].buffer = buffers.data() + i * kMD5MultiReadSize;
+	}
+
+	for (;;) {
+		MD5 *full[kMD5Lanes];
+		const byte *fullData[kMD5Lanes];
+		Lane *fullLanes[kMD5Lanes];
+		uint fullCount = 0;
+		bool active = false;
+
+		for (uint i = 0; i < kMD5Lanes; i++) {
+			Lane &lane = lanes[i];
+			if (lane.stream < 0) {
+				if (next == count)
+					continue;
+				lane.stream = next++;
+				lane.left = length;
+			}
+			active = true;
+
+			uint32 readlen = kMD5MultiReadSize;
+			if (length != 0 && lane.left < readlen)
+				readlen = lane.left;
+
+			const uint32 read = readlen ? streams[lane.stream]->read(lane.buffer, readlen) : 0;
+			if (read > 0 && progressUpdateCallback != nullptr && !progressUpdateCallback(callbackParameter, read))
+				return false;
+			lane.left -= MIN(lane.left, read);
+
+			// The full reads are hashed together, the stream is done otherwise
+			if (read == kMD5MultiReadSize) {
+				full[fullCount] = &md5s[lane.stream];
+				fullData[fullCount] = lane.buffer;
+				fullLanes[fullCount++] = &lane;
+			} else {
+				md5s[lane.stream].update(lane.buffer, read);
+				md5s[lane.stream].getDigest(digests[lane.stream]);
+				lane.stream = -1;
+			}
+		}
+
+		if (!active)
+			break;
+
+		MD5::updateMulti(full, fullData, fullCount, kMD5MultiReadSize);
+
+		// Restricted streams are done as soon as their length is read
+		for (uint i = 0; i < fullCount; i++) {
+			Lane &lane = *fullLanes[i];
+			if (length != 0 && lane.left == 0) {
+				md5s[lane.stream].getDigest(digests[lane.stream]);
+				lane.stream = -1;
+			}
+		}
+	}
 #endif
 	return true;
 }
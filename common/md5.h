@@ -64,6 +64,54 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length = 0, P
  */
 String computeStreamMD5AsString(ReadStream &stream, uint32 length = 0, ProgressUpdateCallback progressUpdateCallback = nullptr, void *callbackParameter = nullptr);
 
+/**
+ * Compute the MD5 checksums of the content of several ReadStreams.
+ * The streams are read in turns and hashed together, which is faster than
+ * hashing them one after the other when SIMD instructions are available.
+ * The progress callback is called with the number of bytes read from each
+ * of the streams.
+ * @param[in] streams	the streams of whose data the MD5s are computed
+ * @param[in] count	the number of streams
+ * @param[out] digests	the computed MD5 checksums, one per stream
+ * @param[in] length	the number of bytes of each stream for which to compute the checksum; 0 means all
+ * @return true on success, false if the callback cancelled the computation
+ */
+bool computeStreamsMD5(ReadStream *const streams[], uint count, uint8 (*digests)[16], uint32 length = 0, ProgressUpdateCallback progressUpdateCallback = nullptr, void *callbackParameter = nullptr);
+
+/**
+ * Incremental computation of an MD5 checksum.
+ */
+class MD5 {
+public:
+	MD5();
+
+	/** Start a new checksum. */
+	void reset();
+
+	/** Add data to the checksum. */
+	void update(const byte *data, uint32 size);
+
+	/**
+	 * Add the same amount of data to several checksums at once. This uses
+	 * SIMD instructions when available, so that several streams can be
+	 * hashed in the time of one.
+	 */
+	static void updateMulti(MD5 *const md5s[], const byte *const data[], uint count, uint32 size);
+
+	/** Get the checksum of the data added so far. More data can still be added afterwards. */
+	void getDigest(uint8 digest[16]) const;
+
+	/** Get the checksum of the data added so far, as a lowercase hex string of length 32. */
+	String getDigestAsString() const;
+
+private:
+	void addLength(uint32 length);
+
+	uint32 _total[2];
+	uint32 _state[4];
+	uint8 _buffer[64];
+};
+
 /** @} */
 
 } // End of namespace Common
@@ -6,6 +6,7 @@ MODULE_OBJS := \
 	btea.o \
 	concatstream.o \
 	config-manager.o \
+	crc.o \
 	coroutines.o \
 	dbcs-str.o \
 	debug.o \
@@ -26,9 +27,12 @@ MODULE_OBJS := \
 	osd_message_queue.o \
 	path.o \
 	platform.o \
+	profiler.o \
 	punycode.o \
 	random.o \
 	rational.o \
+	region.o \
+	rewindbuffer.o \
 	rendermode.o \
 	rotationmode.o \
 	str.o \
@@ -54,6 +58,11 @@ MODULE_OBJS += \
 	recorderfile.o
 endif
 
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	md5-sse2.o
+endif
+
 ifdef USE_UPDATES
 MODULE_OBJS += \
 	updates.o
@@ -0,0 +1,230 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/profiler.h"
+#include "common/str.h"
+#include "common/stream.h"
+#include "common/system.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+bool Profiler::_active = false;
+
+static const char *const trackNames[kProfilerTrackCount] = {
+	"Main",
+	"Audio"
+};
+
+Profiler::Profiler() : _epoch(0), _lastFrameStart(0), _lastFrameEnd(0), _frameCount(0) {
+	for (int i = 0; i < kProfilerTrackCount; ++i) {
+		_tracks[i].next = 0;
+		_tracks[i].count = 0;
+	}
+}
+
+void Profiler::setEnabled(bool enable) {
+	if (enable == _active)
+		return;
+
+	if (enable) {
+		for (int i = 0; i < kProfilerTrackCount; ++i) {
+			StackLock lock(_tracks[i].mutex);
+			_tracks[i].events.resize(kRingSize);
+		}
+		if (_frameCount == 0)
+			reset();
+	}
+	// The buffers are kept after stopping, so that the recording may be exported
+	_active = enable;
+}
+
+void Profiler::reset() {
+	for (int i = 0; i < kProfilerTrackCount; ++i) {
+		StackLock lock(_tracks[i].mutex);
+		_tracks[i].next = 0;
+		_tracks[i].count = 0;
+	}
+	_epoch = g_system->getMicros();
+	_lastFrameStart = _lastFrameEnd = 0;
+	_frameCount = 0;
+}
+
+uint64 Profiler::getTime() const {
+	return g_system->getMicros() - _epoch;
+}
+
+void Profiler::push(ProfilerTrack track, const Event &event) {
+	Ring &ring = _tracks[track];
+	if (track != kProfilerTrackMain)
+		ring.mutex.lock();
+
+	if (_active && !ring.events.empty()) {
+		ring.events[ring.next] = event;
+		ring.next = (ring.next + 1) % kRingSize;
+		if (ring.count < kRingSize)
+			++ring.count;
+	}
+
+	if (track != kProfilerTrackMain)
+		ring.mutex.unlock();
+}
+
+void Profiler::addScope(ProfilerTrack track, const char *name, uint64 start, uint64 end) {
+	Event event;
+	event.name = name;
+	event.start = start;
+	event.duration = (uint32)(end - start);
+	event.value = 0;
+	event.type = kEventScope;
+	push(track, event);
+}
+
+void Profiler::setCounter(const char *name, int32 value, ProfilerTrack track) {
+	if (!_active)
+		return;
+
+	Event event;
+	event.name = name;
+	event.start = getTime();
+	event.duration = 0;
+	event.value = value;
+	event.type = kEventCounter;
+	push(track, event);
+}
+
+void Profiler::endFrame() {
+	if (!_active)
+		return;
+
+	const uint64 now = getTime();
+	Event event;
+	event.name = "Frame";
+	event.start = _lastFrameEnd;
+	event.duration = (uint32)(now - _lastFrameEnd);
+	event.value = (int32)_frameCount;
+	event.type = kEventFrame;
+	push(kProfilerTrackMain, event);
+
+	_lastFrameStart = _lastFrameEnd;
+	_lastFrameEnd = now;
+	++_frameCount;
+}
+
+void Profiler::getLastFrameStats(Array<ScopeStats> &stats, ProfilerTrack track) {
+	stats.resize(0);
+	if (_frameCount == 0)
+		return;
+
+	Ring &ring = _tracks[track];
+	StackLock lock(ring.mutex);
+
+	// Events are stored in the order they finished, so count the ones
+	// which finished within the last frame walking back from the newest
+	uint32 count = 0;
+	while (count < ring.count) {
+		const Event &event = ring.events[(ring.next + kRingSize - 1 - count) % kRingSize];
+		if (event.start + event.duration < _lastFrameStart)
+			break;
+		++count;
+	}
+
+	for (uint32 i = count; i > 0; --i) {
+		const Event &event = ring.events[(ring.next + kRingSize - i) % kRingSize];
+		if ((event.type != kEventScope) || (event.start < _lastFrameStart) ||
+				(event.start + event.duration > _lastFrameEnd))
+			continue;
+
+		uint j = 0;
+		while ((j < stats.size()) && (stats[j].name != event.name))
+			++j;
+		if (j == stats.size()) {
+			ScopeStats scope;
+			scope.name = event.name;
+			scope.calls = 0;
+			scope.total = 0;
+			stats.push_back(scope);
+		}
+		++stats[j].calls;
+		stats[j].total += event.duration;
+	}
+}
+
+String Profiler::escapeJSON(const char *str) {
+	String result;
+	for (; *str; ++str) {
+		if (*str == '"' || *str == '\\')
+			result += '\\';
+		if ((byte)*str < ' ')
+			result += String::format("\\u%04x", (byte)*str);
+		else
+			result += *str;
+	}
+	return result;
+}
+
+bool Profiler::writeChromeTrace(WriteStream &stream) {
+	stream.writeString("{\"traceEvents\":[\n");
+
+	// Name the timelines; frames get one of their own, as they may
+	// overlap scopes which run across several screen updates
+	for (int i = 0; i <= kProfilerTrackCount; ++i) {
+		stream.writeString(String::format(
+			"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+			i, (i < kProfilerTrackCount) ? trackNames[i] : "Frames"));
+	}
+
+	bool first = true;
+	for (int i = 0; i < kProfilerTrackCount; ++i) {
+		Ring &ring = _tracks[i];
+		StackLock lock(ring.mutex);
+
+		const uint32 oldest = (ring.next + kRingSize - ring.count) % kRingSize;
+		for (uint32 j = 0; j < ring.count; ++j) {
+			const Event &event = ring.events[(oldest + j) % kRingSize];
+			String line = first ? "" : ",\n";
+			first = false;
+
+			const String name = escapeJSON(event.name);
+			switch (event.type) {
+			case kEventScope:
+				line += String::format("{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,\"pid\":1,\"tid\":%d}",
+					name.c_str(), (unsigned long long)event.start, event.duration, i);
+				break;
+			case kEventCounter:
+				line += String::format("{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%llu,\"pid\":1,\"tid\":%d,\"args\":{\"value\":%d}}",
+					name.c_str(), (unsigned long long)event.start, i, event.value);
+				break;
+			default:
+				line += String::format("{\"name\":\"%s %d\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,\"pid\":1,\"tid\":%d}",
+					name.c_str(), event.value, (unsigned long long)event.start, event.duration, kProfilerTrackCount);
+				break;
+			}
+			stream.writeString(line);
+		}
+	}
+
+	stream.writeString("\n]}\n");
+	return !stream.err();
+}
+
+} // End of namespace Common
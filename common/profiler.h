@@ -0,0 +1,199 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/array.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+namespace Common {
+
+class WriteStream;
+
+/**
+ * @defgroup common_profiler Profiler
+ * @ingroup common
+ *
+ * @brief Lightweight frame profiler with named scopes and counters.
+ * @{
+ */
+
+/**
+ * Timeline an event is recorded on.
+ *
+ * Every track has its own ring buffer and is only ever written to from one
+ * thread, so the main track does not need any locking.
+ */
+enum ProfilerTrack {
+	kProfilerTrackMain = 0,  ///< Engine thread
+	kProfilerTrackAudio,     ///< Audio mixer callback
+	kProfilerTrackCount
+};
+
+/**
+ * Records timed scopes and counter values into per-track ring buffers.
+ *
+ * Recording is off by default, and instrumented code only pays for a single
+ * flag test then. The recorded events may be summarized per frame (frames end
+ * with each screen update) or exported as a Chrome trace, which can be viewed
+ * in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Scope and counter names are stored as pointers, so they must be string
+ * literals or otherwise outlive the recording.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	enum EventType {
+		kEventScope,
+		kEventCounter,
+		kEventFrame
+	};
+
+	struct Event {
+		const char *name;
+		uint64 start;     ///< Start time, in microseconds
+		uint32 duration;  ///< Duration, in microseconds (scopes and frames)
+		int32 value;      ///< Counter value
+		byte type;
+	};
+
+	/** Summary of all the calls of one scope. */
+	struct ScopeStats {
+		const char *name;
+		uint32 calls;
+		uint32 total;     ///< Total duration, in microseconds
+	};
+
+	enum {
+		kRingSize = 1 << 16 ///< Number of events kept per track
+	};
+
+	Profiler();
+
+	/** Tell whether events are being recorded. Cheap enough to test anywhere. */
+	static bool isActive() { return _active; }
+
+	/** Start or stop recording. Starting allocates the ring buffers. */
+	void setEnabled(bool enable);
+
+	/** Forget all the recorded events. */
+	void reset();
+
+	/** Current profiler time, in microseconds. */
+	uint64 getTime() const;
+
+	/** Record a finished scope. */
+	void addScope(ProfilerTrack track, const char *name, uint64 start, uint64 end);
+
+	/** Record the current value of a counter. */
+	void setCounter(const char *name, int32 value, ProfilerTrack track = kProfilerTrackMain);
+
+	/** Mark the end of the current frame. Called on each screen update. */
+	void endFrame();
+
+	/** Number of frames recorded so far. */
+	uint32 getFrameCount() const { return _frameCount; }
+
+	/** Duration of the last complete frame, in microseconds. */
+	uint32 getLastFrameTime() const { return (uint32)(_lastFrameEnd - _lastFrameStart); }
+
+	/**
+	 * Summarize the scopes recorded on a track during the last complete frame,
+	 * in the order their first call finished.
+	 */
+	void getLastFrameStats(Array<ScopeStats> &stats, ProfilerTrack track = kProfilerTrackMain);
+
+	/**
+	 * Write all the recorded events in the Chrome trace event JSON format.
+	 *
+	 * @return true if the whole trace was written successfully.
+	 */
+	bool writeChromeTrace(WriteStream &stream);
+
+	/** Escape a string to be written between quotes in a JSON report. */
+	static String escapeJSON(const char *str);
+
+private:
+	struct Ring {
+		Array<Event> events;
+		uint32 next;   ///< Index the next event is stored at
+		uint32 count;  ///< Number of valid events, up to kRingSize
+		Mutex mutex;   ///< Held by all but the main track
+	};
+
+	void push(ProfilerTrack track, const Event &event);
+
+	static bool _active;
+
+	Ring _tracks[kProfilerTrackCount];
+	uint64 _epoch;
+	uint64 _lastFrameStart;
+	uint64 _lastFrameEnd;
+	uint32 _frameCount;
+};
+
+/**
+ * Records the lifetime of the object as a named scope on the given track.
+ */
+class ProfilerScope : NonCopyable {
+public:
+	ProfilerScope(const char *name, ProfilerTrack track = kProfilerTrackMain) : _name(nullptr) {
+		if (Profiler::isActive()) {
+			_name = name;
+			_track = track;
+			_start = Profiler::instance().getTime();
+		}
+	}
+
+	~ProfilerScope() {
+		// Profiling could have been stopped meanwhile, addScope() checks that
+		if (_name)
+			Profiler::instance().addScope(_track, _name, _start, Profiler::instance().getTime());
+	}
+
+private:
+	const char *_name;
+	ProfilerTrack _track;
+	uint64 _start;
+};
+
+#define PROFILER_SCOPE_CONCAT_(a, b) a##b
+#define PROFILER_SCOPE_CONCAT(a, b) PROFILER_SCOPE_CONCAT_(a, b)
+
+/** Profile the rest of the enclosing block as a scope named @p name. */
+#define PROFILE_SCOPE(name) \
+	Common::ProfilerScope PROFILER_SCOPE_CONCAT(profilerScope, __LINE__)(name)
+
+/** Same as PROFILE_SCOPE, but for code running on another track. */
+#define PROFILE_SCOPE_TRACK(name, track) \
+	Common::ProfilerScope PROFILER_SCOPE_CONCAT(profilerScope, __LINE__)(name, track)
+
+/** @} */
+
+} // End of namespace Common
+
+/** Shortcut for accessing the profiler. */
+#define ProfMan		Common::Profiler::instance()
+
+#endif
@@ -47,6 +47,8 @@ PlaybackFile::PlaybackFile()
 	_recordCount = 0;
 	_eventsSize = 0;
 	_version = RECORD_VERSION;
+	_screenChecks = 0;
+	_screenMismatches = 0;
 	memset(_tmpBuffer.data(), 1, kRecordBuffSize);
 
 	_playbackParseState = kFileStateCheckFormat;
@@ -334,6 +336,7 @@ bool PlaybackFile::hasNextEvent() const {
 RecorderEvent PlaybackFile::getNextEvent() {
 	if (!hasNextEvent()) {
 		debug(3, "end of recorder file reached.");
+		g_eventRec.processPlaybackEnd();
 		g_system->quit();
 	}
 
@@ -795,7 +798,9 @@ void PlaybackFile::checkRecordedMD5() {
 	}
 	uint32 seconds = g_system->getMillis(true) / 1000;
 	String screenTime = String::format("%.2d:%.2d:%.2d", seconds / 3600 % 24, seconds / 60 % 60, seconds % 60);
+	_screenChecks++;
 	if (memcmp(savedMD5, currentMD5, 16) != 0) {
+		_screenMismatches++;
 		debugC(1, kDebugLevelEventRec, "playback:action=\"Check screenshot\" time=%s result = fail", screenTime.c_str());
 		warning("Recorded and current screenshots are different");
 	} else {
@@ -159,6 +159,11 @@ public:
 	void addSaveFile(const String &fileName, InSaveFile *saveStream);
 
 	uint32 getVersion() const {return _version;}
+
+	/** Number of recorded screen checksums compared during playback */
+	uint32 getScreenChecksCount() const {return _screenChecks;}
+	/** Number of those checksums which did not match the current screen */
+	uint32 getScreenMismatchesCount() const {return _screenMismatches;}
 private:
 	Array<byte> _tmpBuffer;
 	WriteStream *_recordFile;
@@ -175,6 +180,8 @@ private:
 	PlaybackFileHeader _header;
 	PlaybackFileState _playbackParseState;
 	uint32 _version;
+	uint32 _screenChecks;
+	uint32 _screenMismatches;
 
 	void skipHeader();
 	bool parseHeader();
@@ -0,0 +1,308 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/region.h"
+
+namespace Common {
+
+Region::Region(const Rect &rect) {
+	if (!rect.isEmpty()) {
+		_rects.push_back(rect);
+		_bounds = rect;
+	}
+}
+
+uint32 Region::getArea() const {
+	uint32 area = 0;
+	for (const Rect &r : _rects)
+		area += (uint32)r.width() * r.height();
+	return area;
+}
+
+bool Region::contains(int16 x, int16 y) const {
+	if (!_bounds.contains(x, y))
+		return false;
+
+	for (const Rect &r : _rects) {
+		if (r.top > y)
+			break;
+		if (r.contains(x, y))
+			return true;
+	}
+	return false;
+}
+
+bool Region::intersects(const Rect &rect) const {
+	if (isEmpty() || !_bounds.intersects(rect))
+		return false;
+
+	for (const Rect &r : _rects) {
+		if (r.top >= rect.bottom)
+			break;
+		if (r.intersects(rect))
+			return true;
+	}
+	return false;
+}
+
+void Region::clear() {
+	_rects.resize(0);
+	_bounds = Rect();
+}
+
+void Region::unite(const Rect &rect) {
+	if (rect.isEmpty())
+		return;
+
+	if (isEmpty() || rect.contains(_bounds)) {
+		_rects.resize(0);
+		_rects.push_back(rect);
+		_bounds = rect;
+		return;
+	}
+
+	if (rect.top >= _bounds.bottom) {
+		// Rectangles are often added from top to bottom, which only
+		// needs a new band, or extending the last one
+		Rect &last = _rects.back();
+		bool lastBandIsSingle = (_rects.size() == 1) || (_rects[_rects.size() - 2].top != last.top);
+		if (lastBandIsSingle && last.bottom == rect.top && last.left == rect.left && last.right == rect.right)
+			last.bottom = rect.bottom;
+		else
+			_rects.push_back(rect);
+		_bounds.extend(rect);
+		return;
+	}
+
+	combine(&rect, 1, kOpUnion);
+}
+
+void Region::unite(const Region &region) {
+	if (region.isEmpty())
+		return;
+
+	if (isEmpty()) {
+		_rects = region._rects;
+		_bounds = region._bounds;
+		return;
+	}
+
+	combine(region._rects.data(), region._rects.size(), kOpUnion);
+}
+
+void Region::intersect(const Rect &rect) {
+	if (isEmpty() || rect.contains(_bounds))
+		return;
+
+	if (!rect.intersects(_bounds)) {
+		clear();
+		return;
+	}
+
+	combine(&rect, 1, kOpIntersect);
+}
+
+void Region::intersect(const Region &region) {
+	if (isEmpty() || region.isEmpty() || !region._bounds.intersects(_bounds)) {
+		clear();
+		return;
+	}
+
+	combine(region._rects.data(), region._rects.size(), kOpIntersect);
+}
+
+void Region::subtract(const Rect &rect) {
+	if (isEmpty() || rect.isEmpty() || !rect.intersects(_bounds))
+		return;
+
+	if (rect.contains(_bounds)) {
+		clear();
+		return;
+	}
+
+	combine(&rect, 1, kOpSubtract);
+}
+
+void Region::subtract(const Region &region) {
+	if (isEmpty() || region.isEmpty() || !region._bounds.intersects(_bounds))
+		return;
+
+	combine(region._rects.data(), region._rects.size(), kOpSubtract);
+}
+
+void Region::translate(int16 dx, int16 dy) {
+	for (Rect &r : _rects)
+		r.translate(dx, dy);
+	_bounds.translate(dx, dy);
+}
+
+bool Region::simplify(uint32 rectCost) {
+	if (_rects.size() <= 1)
+		return false;
+
+	uint32 cost = getArea() + _rects.size() * rectCost;
+	uint32 boundsCost = (uint32)_bounds.width() * _bounds.height() + rectCost;
+	if (boundsCost > cost)
+		return false;
+
+	_rects.resize(0);
+	_rects.push_back(_bounds);
+	return true;
+}
+
+namespace {
+
+/** Index of the first rectangle after the band starting at @p start */
+uint bandEnd(const Rect *rects, uint size, uint start) {
+	uint end = start + 1;
+	while (end < size && rects[end].top == rects[start].top)
+		++end;
+	return end;
+}
+
+/** Append a span to the band being built, merging it with the previous touching span */
+void addSpan(Array<Rect> &out, uint bandStart, int16 left, int16 right, int16 top, int16 bottom) {
+	if (left >= right)
+		return;
+
+	if (out.size() > bandStart && out.back().right >= left) {
+		out.back().right = MAX(out.back().right, right);
+		return;
+	}
+	out.push_back(Rect(left, top, right, bottom));
+}
+
+} // End of anonymous namespace
+
+void Region::combine(const Rect *other, uint otherSize, Operation op) {
+	const Rect *a = _rects.data();
+	const uint aSize = _rects.size();
+	const Rect *b = other;
+	const uint bSize = otherSize;
+	Array<Rect> &out = _result;
+	out.resize(0);
+
+	uint ia = 0, ib = 0;
+	uint prevBand = 0, prevBandSize = 0;
+	int16 y = MIN(a[0].top, b[0].top);
+
+	while (ia < aSize || ib < bSize) {
+		// Nothing more can come out of the remaining bands
+		if (ia == aSize && op != kOpUnion)
+			break;
+		if (ib == bSize && op == kOpIntersect)
+			break;
+
+		const bool inA = (ia < aSize) && (a[ia].top <= y);
+		const bool inB = (ib < bSize) && (b[ib].top <= y);
+		const uint aEnd = inA ? bandEnd(a, aSize, ia) : ia;
+		const uint bEnd = inB ? bandEnd(b, bSize, ib) : ib;
+
+		// The current slice ends at the next top or bottom edge of either side
+		int16 next = 0x7FFF;
+		if (ia < aSize)
+			next = MIN(next, inA ? a[ia].bottom : a[ia].top);
+		if (ib < bSize)
+			next = MIN(next, inB ? b[ib].bottom : b[ib].top);
+
+		const uint bandStart = out.size();
+		uint i = ia, j = ib;
+		switch (op) {
+		case kOpUnion:
+			while (i < aEnd || j < bEnd) {
+				const Rect &r = (j == bEnd || (i < aEnd && a[i].left <= b[j].left)) ? a[i++] : b[j++];
+				addSpan(out, bandStart, r.left, r.right, y, next);
+			}
+			break;
+
+		case kOpIntersect:
+			while (i < aEnd && j < bEnd) {
+				addSpan(out, bandStart, MAX(a[i].left, b[j].left), MIN(a[i].right, b[j].right), y, next);
+				if (a[i].right < b[j].right)
+					++i;
+				else
+					++j;
+			}
+			break;
+
+		case kOpSubtract:
+			for (; i < aEnd; ++i) {
+				int16 left = a[i].left;
+				// Skip the spans entirely on the left, and cut out the overlapping ones
+				while (j < bEnd && b[j].right <= left)
+					++j;
+				for (uint k = j; k < bEnd && b[k].left < a[i].right; ++k) {
+					addSpan(out, bandStart, left, b[k].left, y, next);
+					left = MAX(left, b[k].right);
+				}
+				addSpan(out, bandStart, left, a[i].right, y, next);
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		// Merge the band with the previous one if they have the same spans
+		const uint bandSize = out.size() - bandStart;
+		if (bandSize > 0) {
+			bool same = (bandSize == prevBandSize) && (out[prevBand].bottom == y);
+			for (uint k = 0; same && k < bandSize; ++k) {
+				same = (out[prevBand + k].left == out[bandStart + k].left) &&
+					(out[prevBand + k].right == out[bandStart + k].right);
+			}
+
+			if (same) {
+				for (uint k = 0; k < bandSize; ++k)
+					out[prevBand + k].bottom = next;
+				out.resize(bandStart);
+			} else {
+				prevBand = bandStart;
+				prevBandSize = bandSize;
+			}
+		}
+
+		y = next;
+		if (inA && a[ia].bottom == y)
+			ia = aEnd;
+		if (inB && b[ib].bottom == y)
+			ib = bEnd;
+	}
+
+	_rects.swap(_result);
+	updateBounds();
+}
+
+void Region::updateBounds() {
+	if (_rects.empty()) {
+		_bounds = Rect();
+		return;
+	}
+
+	_bounds = _rects.front();
+	_bounds.bottom = _rects.back().bottom;
+	for (const Rect &r : _rects) {
+		_bounds.left = MIN(_bounds.left, r.left);
+		_bounds.right = MAX(_bounds.right, r.right);
+	}
+}
+
+} // End of namespace Common
@@ -0,0 +1,132 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_REGION_H
+#define COMMON_REGION_H
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_region Regions
+ * @ingroup common
+ *
+ * @brief Sets of pixels described by non-overlapping rectangles.
+ *
+ * @{
+ */
+
+/**
+ * An arbitrary area, stored as a list of non-overlapping rectangles.
+ *
+ * The rectangles are kept in y-x banded order, as with X11 and pixman
+ * regions: they are grouped in bands of rectangles sharing the same top and
+ * bottom, sorted from left to right, and the bands are sorted from top to
+ * bottom without overlapping each other. Vertically adjacent bands with the
+ * same horizontal spans are merged.
+ *
+ * This keeps the operations linear in the number of rectangles, and makes
+ * the representation of a given area unique.
+ */
+class Region {
+public:
+	typedef Array<Rect>::const_iterator const_iterator;
+
+	Region() {}
+	Region(const Rect &rect);
+
+	/** Check whether the region does not contain any pixel. */
+	bool isEmpty() const { return _rects.empty(); }
+
+	/** Number of rectangles making up the region. */
+	uint size() const { return _rects.size(); }
+
+	/** Rectangles making up the region, in banded order. */
+	const Array<Rect> &getRects() const { return _rects; }
+	const_iterator begin() const { return _rects.begin(); }
+	const_iterator end() const { return _rects.end(); }
+
+	/** Smallest rectangle containing the whole region. */
+	const Rect &getBounds() const { return _bounds; }
+
+	/** Number of pixels in the region. */
+	uint32 getArea() const;
+
+	bool contains(int16 x, int16 y) const;
+	bool contains(const Point &p) const { return contains(p.x, p.y); }
+
+	/** Check whether the region has any pixel in common with @p rect. */
+	bool intersects(const Rect &rect) const;
+
+	bool operator==(const Region &region) const { return _rects == region._rects; }
+	bool operator!=(const Region &region) const { return !(*this == region); }
+
+	/** Remove all pixels, keeping the allocated storage. */
+	void clear();
+
+	/** Add the pixels of @p rect to the region. */
+	void unite(const Rect &rect);
+	void unite(const Region &region);
+
+	/** Only keep the pixels which are also in @p rect. */
+	void intersect(const Rect &rect);
+	void intersect(const Region &region);
+
+	/** Remove the pixels of @p rect from the region. */
+	void subtract(const Rect &rect);
+	void subtract(const Region &region);
+
+	void translate(int16 dx, int16 dy);
+
+	/**
+	 * Replace the region by its bounds if that is cheaper to update.
+	 *
+	 * Updating the region rectangle by rectangle is deemed to cost the area
+	 * of the rectangles plus @p rectCost pixels for each of them.
+	 *
+	 * @return true if the region was replaced by its bounds.
+	 */
+	bool simplify(uint32 rectCost);
+
+private:
+	enum Operation {
+		kOpUnion,
+		kOpIntersect,
+		kOpSubtract
+	};
+
+	void combine(const Rect *other, uint otherSize, Operation op);
+	void updateBounds();
+
+	Array<Rect> _rects;
+	Rect _bounds;
+
+	/** Storage reused across operations, to avoid reallocating it */
+	Array<Rect> _result;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,300 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/rewindbuffer.h"
+#include "common/endian.h"
+#include "common/util.h"
+
+namespace Common {
+
+namespace {
+
+// The codec is a byte-oriented LZ77, in the spirit of LZ4. Each sequence
+// starts with a token byte, holding the number of literals in its high
+// nibble and the match length minus kMinMatch in its low nibble, a nibble
+// of 15 being continued by extra length bytes. The literals follow, then
+// the 16-bit match offset. The last sequence only has literals.
+enum {
+	kMinMatch = 4,
+	kHashBits = 12,
+	kMaxOffset = 65535
+};
+
+byte *writeLength(byte *dst, uint32 length) {
+	while (length >= 255) {
+		*dst++ = 255;
+		length -= 255;
+	}
+	*dst++ = (byte)length;
+	return dst;
+}
+
+bool readLength(const byte *&src, const byte *end, uint32 &length) {
+	byte b;
+	do {
+		if (src == end)
+			return false;
+		b = *src++;
+		length += b;
+	} while (b == 255);
+	return true;
+}
+
+byte *writeSequence(byte *dst, const byte *literals, uint32 literalCount, uint32 offset, uint32 matchLength) {
+	const uint32 matchCode = matchLength ? matchLength - kMinMatch : 0;
+
+	*dst++ = (MIN<uint32>(literalCount, 15) << 4) | MIN<uint32>(matchCode, 15);
+	if (literalCount >= 15)
+		dst = writeLength(dst, literalCount - 15);
+
+	memcpy(dst, literals, literalCount);
+	dst += literalCount;
+
+	if (matchLength) {
+		WRITE_LE_UINT16(dst, offset);
+		dst += 2;
+		if (matchCode >= 15)
+			dst = writeLength(dst, matchCode - 15);
+	}
+	return dst;
+}
+
+} // End of anonymous namespace
+
+uint32 RewindBuffer::compress(const byte *src, uint32 size, byte *dst) {
+	// Last position + 1 of each hashed 4-byte sequence, 0 for none
+	uint32 table[1 << kHashBits];
+	memset(table, 0, sizeof(table));
+
+	byte *out = dst;
+	uint32 anchor = 0;
+	uint32 pos = 0;
+
+	while (pos + kMinMatch <= size) {
+		const uint32 sequence = READ_UINT32(src + pos);
+		const uint32 hash = (sequence * 2654435761U) >> (32 - kHashBits);
+		const uint32 candidate = table[hash];
+		table[hash] = pos + 1;
+
+		if (candidate == 0 || pos - (candidate - 1) > kMaxOffset || READ_UINT32(src + candidate - 1) != sequence) {
+			++pos;
+			continue;
+		}
+
+		const uint32 matchPos = candidate - 1;
+		uint32 matchLength = kMinMatch;
+		while (pos + matchLength < size && src[matchPos + matchLength] == src[pos + matchLength])
+			++matchLength;
+
+		out = writeSequence(out, src + anchor, pos - anchor, pos - matchPos, matchLength);
+		pos += matchLength;
+		anchor = pos;
+	}
+
+	out = writeSequence(out, src + anchor, size - anchor, 0, 0);
+	return out - dst;
+}
+
+bool RewindBuffer::decompress(const byte *src, uint32 srcSize, byte *dst, uint32 dstSize) {
+	const byte *in = src;
+	const byte *inEnd = src + srcSize;
+	byte *out = dst;
+	byte *outEnd = dst + dstSize;
+
+	for (;;) {
+		// The data always ends with a sequence without match
+		if (in == inEnd)
+			return false;
+
+		const byte token = *in++;
+
+		uint32 literalCount = token >> 4;
+		if (literalCount == 15 && !readLength(in, inEnd, literalCount))
+			return false;
+		if ((uint32)(inEnd - in) < literalCount || (uint32)(outEnd - out) < literalCount)
+			return false;
+
+		memcpy(out, in, literalCount);
+		in += literalCount;
+		out += literalCount;
+
+		if (in == inEnd)
+			return out == outEnd;
+
+		if (inEnd - in < 2)
+			return false;
+		const uint32 offset = READ_LE_UINT16(in);
+		in += 2;
+
+		uint32 matchLength = token & 15;
+		if (matchLength == 15 && !readLength(in, inEnd, matchLength))
+			return false;
+		matchLength += kMinMatch;
+
+		if (offset == 0 || offset > (uint32)(out - dst) || (uint32)(outEnd - out) < matchLength)
+			return false;
+
+		// The match may overlap the bytes it produces
+		const byte *match = out - offset;
+		for (uint32 i = 0; i < matchLength; ++i)
+			out[i] = match[i];
+		out += matchLength;
+	}
+}
+
+RewindBuffer::RewindBuffer(uint32 memoryBudget, uint32 blockSize)
+	: _memoryBudget(memoryBudget), _blockSize(MAX<uint32>(blockSize, 1)), _memoryUsage(0), _allocatedBytes(0), _newestValid(true) {
+	_compressBuffer.resize(getMaxCompressedSize(_blockSize));
+}
+
+RewindBuffer::~RewindBuffer() {
+	clear();
+}
+
+void RewindBuffer::clear() {
+	while (!_snapshots.empty())
+		dropOldest();
+
+	_newest.clear();
+	_newestValid = true;
+}
+
+uint32 RewindBuffer::getBlockMemory(const Block *block) {
+	return sizeof(Block) + block->data.size();
+}
+
+RewindBuffer::Block *RewindBuffer::createBlock(const byte *data, uint32 size) {
+	Block *block = new Block();
+	block->refs = 1;
+	block->size = size;
+
+	const uint32 compressedSize = compress(data, size, _compressBuffer.data());
+	block->compressed = compressedSize < size;
+	if (block->compressed) {
+		block->data.resize(compressedSize);
+		memcpy(block->data.data(), _compressBuffer.data(), compressedSize);
+	} else {
+		block->data.resize(size);
+		memcpy(block->data.data(), data, size);
+	}
+
+	const uint32 memory = getBlockMemory(block);
+	_memoryUsage += memory;
+	_allocatedBytes += memory;
+	return block;
+}
+
+void RewindBuffer::releaseBlock(Block *block) {
+	if (--block->refs)
+		return;
+
+	_memoryUsage -= getBlockMemory(block);
+	delete block;
+}
+
+void RewindBuffer::releaseSnapshot(Snapshot *snapshot) {
+	for (Block *block : snapshot->blocks)
+		releaseBlock(block);
+
+	_memoryUsage -= sizeof(Snapshot) + snapshot->blocks.size() * sizeof(Block *);
+	delete snapshot;
+}
+
+void RewindBuffer::dropOldest() {
+	Snapshot *snapshot = _snapshots.front();
+	_snapshots.remove_at(0);
+	releaseSnapshot(snapshot);
+}
+
+bool RewindBuffer::decode(const Snapshot *snapshot, Array<byte> &data) const {
+	data.resize(snapshot->size);
+
+	uint32 offset = 0;
+	for (const Block *block : snapshot->blocks) {
+		if (block->compressed) {
+			if (!decompress(block->data.data(), block->data.size(), data.data() + offset, block->size))
+				return false;
+		} else {
+			memcpy(data.data() + offset, block->data.data(), block->size);
+		}
+		offset += block->size;
+	}
+
+	return true;
+}
+
+void RewindBuffer::push(const byte *data, uint32 size) {
+	if (!_newestValid) {
+		if (_snapshots.empty() || !decode(_snapshots.back(), _newest))
+			_newest.clear();
+		_newestValid = true;
+	}
+
+	// Share the blocks which did not change since the previous snapshot
+	const Snapshot *previous = _snapshots.empty() ? nullptr : _snapshots.back();
+	const uint32 blockCount = (size + _blockSize - 1) / _blockSize;
+
+	Snapshot *snapshot = new Snapshot();
+	snapshot->size = size;
+	snapshot->blocks.resize(blockCount);
+
+	for (uint32 i = 0; i < blockCount; ++i) {
+		const uint32 offset = i * _blockSize;
+		const uint32 blockSize = MIN(_blockSize, size - offset);
+
+		Block *block;
+		if (previous && i < previous->blocks.size() && previous->blocks[i]->size == blockSize &&
+				offset + blockSize <= _newest.size() && !memcmp(_newest.data() + offset, data + offset, blockSize)) {
+			block = previous->blocks[i];
+			++block->refs;
+		} else {
+			block = createBlock(data + offset, blockSize);
+		}
+		snapshot->blocks[i] = block;
+	}
+
+	_memoryUsage += sizeof(Snapshot) + blockCount * sizeof(Block *);
+	_snapshots.push_back(snapshot);
+
+	_newest.resize(size);
+	if (size)
+		memcpy(_newest.data(), data, size);
+
+	while (_memoryUsage > _memoryBudget && _snapshots.size() > 1)
+		dropOldest();
+}
+
+bool RewindBuffer::pop(Array<byte> &data) {
+	if (_snapshots.empty())
+		return false;
+
+	Snapshot *snapshot = _snapshots.back();
+	const bool decoded = decode(snapshot, data);
+
+	_snapshots.pop_back();
+	releaseSnapshot(snapshot);
+
+	// The blocks of the next snapshot are compared against the new newest one
+	_newestValid = false;
+	return decoded;
+}
+
+} // End of namespace Common
@@ -0,0 +1,139 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_REWINDBUFFER_H
+#define COMMON_REWINDBUFFER_H
+
+#include "common/array.h"
+#include "common/noncopyable.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_rewindbuffer Rewind buffer
+ * @ingroup common
+ *
+ * @brief Compressed in-memory history of game states.
+ *
+ * @{
+ */
+
+/**
+ * In-memory history of snapshots, such as save states, kept within a
+ * memory budget.
+ *
+ * The snapshots are split in fixed-size blocks. The blocks which did not
+ * change since the previous snapshot are shared with it, and the others are
+ * compressed with a fast LZ77 codec. When the budget is exceeded, the
+ * oldest snapshots are dropped, but the newest one is always kept.
+ *
+ * The uncompressed copy of the newest snapshot, used for comparing the
+ * blocks, is not counted in the budget.
+ */
+class RewindBuffer : NonCopyable {
+public:
+	enum {
+		kDefaultBlockSize = 4096
+	};
+
+	RewindBuffer(uint32 memoryBudget, uint32 blockSize = kDefaultBlockSize);
+	~RewindBuffer();
+
+	/** Add a snapshot, dropping the oldest ones if the budget is exceeded. */
+	void push(const byte *data, uint32 size);
+
+	/**
+	 * Remove the newest snapshot.
+	 *
+	 * @param data Receives the content of the snapshot.
+	 * @return false if there is no snapshot, or it could not be decoded.
+	 */
+	bool pop(Array<byte> &data);
+
+	/** Drop all the snapshots. */
+	void clear();
+
+	/** Number of snapshots stored. */
+	uint size() const { return _snapshots.size(); }
+	bool empty() const { return _snapshots.empty(); }
+
+	/** Memory used by the snapshots, in bytes. */
+	uint32 getMemoryUsage() const { return _memoryUsage; }
+	uint32 getMemoryBudget() const { return _memoryBudget; }
+
+	/** Memory allocated for the new blocks of all the snapshots pushed so far, in bytes. */
+	uint64 getAllocatedBytes() const { return _allocatedBytes; }
+
+	/** Size of a buffer large enough for compressing size bytes. */
+	static uint32 getMaxCompressedSize(uint32 size) { return size + size / 255 + 16; }
+
+	/**
+	 * Compress data with the block codec.
+	 *
+	 * @param dst Buffer of at least getMaxCompressedSize(size) bytes.
+	 * @return Size of the compressed data.
+	 */
+	static uint32 compress(const byte *src, uint32 size, byte *dst);
+
+	/**
+	 * Decompress data compressed with compress().
+	 *
+	 * @return false if the data is corrupted or does not decompress to exactly dstSize bytes.
+	 */
+	static bool decompress(const byte *src, uint32 srcSize, byte *dst, uint32 dstSize);
+
+private:
+	struct Block {
+		uint32 refs;
+		uint32 size;       ///< Uncompressed size
+		bool compressed;   ///< false if stored as is because it did not compress
+		Array<byte> data;
+	};
+
+	struct Snapshot {
+		uint32 size;
+		Array<Block *> blocks;
+	};
+
+	Block *createBlock(const byte *data, uint32 size);
+	void releaseBlock(Block *block);
+	static uint32 getBlockMemory(const Block *block);
+
+	void releaseSnapshot(Snapshot *snapshot);
+	void dropOldest();
+	bool decode(const Snapshot *snapshot, Array<byte> &data) const;
+
+	uint32 _memoryBudget;
+	uint32 _blockSize;
+	uint32 _memoryUsage;
+	uint64 _allocatedBytes;
+
+	Array<Snapshot *> _snapshots;  ///< Oldest first
+	Array<byte> _newest;           ///< Content of the newest snapshot
+	bool _newestValid;             ///< false if _newest has to be decoded again
+	Array<byte> _compressBuffer;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -261,6 +261,17 @@ public:
 	 */
 	virtual StringArray listSavefiles(const String &pattern) = 0;
 
+	/**
+	 * Get the size and the modification time of a save file, without opening it.
+	 *
+	 * @param name       Name of the save file.
+	 * @param size       Size of the file, in bytes.
+	 * @param timestamp  Modification time of the file, in seconds since the epoch.
+	 *
+	 * @return true if the backend could tell them. false otherwise.
+	 */
+	virtual bool getSavefileInfo(const String &name, uint32 &size, uint32 &timestamp) { return false; }
+
 	/**
 	 * Refresh the save files list (because some new files might have been added)
 	 * and remember the "locked" files list. These files cannot be used
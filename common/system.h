@@ -1549,6 +1549,17 @@ public:
 	 */
 	virtual uint32 getMillis(bool skipRecord = false) = 0;
 
+	/**
+	 * Get the current value of a monotonic clock, in microseconds.
+	 *
+	 * Only the difference between two values is meaningful. This is meant
+	 * for measuring short intervals, such as when profiling, and is never
+	 * recorded by the event recorder. Backends without a
+	 * high resolution timer may rely on the default implementation, which
+	 * is only as precise as getMillis().
+	 */
+	virtual uint64 getMicros() { return (uint64)getMillis(true) * 1000; }
+
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
@@ -340,6 +340,8 @@ int CharacterInfo::update_character_animating(int &aa, int &doing_nothing) {
 
 			if (done_anim)
 				stop_character_anim(this);
+			else
+				PrefetchViewAnim(view, loop, frame, get_anim_forwards(), get_anim_repeat());
 		}
 	}
 
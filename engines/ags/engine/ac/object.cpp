@@ -39,6 +39,7 @@
 #include "ags/engine/main/game_run.h"
 #include "ags/engine/ac/route_finder.h"
 #include "ags/engine/gfx/graphics_driver.h"
+#include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/ac/view.h"
 #include "ags/engine/ac/view_frame.h"
 #include "ags/shared/gfx/bitmap.h"
@@ -718,6 +719,16 @@ bool CycleViewAnim(int view, uint16_t &o_loop, uint16_t &o_frame, bool forwards,
 	return !done; // have we finished animating?
 }
 
+void PrefetchViewAnim(int view, int loop, int frame, bool forwards, int repeat, int lookahead) {
+	uint16_t next_loop = static_cast<uint16_t>(loop);
+	uint16_t next_frame = static_cast<uint16_t>(frame);
+	for (int i = 0; i < lookahead; ++i) {
+		if (!CycleViewAnim(view, next_loop, next_frame, forwards, repeat))
+			break;
+		_GP(spriteset).PrefetchSprite(_GP(views)[view].loops[next_loop].frames[next_frame].pic);
+	}
+}
+
 //=============================================================================
 //
 // Script API Functions
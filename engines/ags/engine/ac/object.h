@@ -133,6 +133,9 @@ int     SetFirstAnimFrame(int view, int loop, int sframe, int direction);
 // loop and frame values are passed by reference and will be updated;
 // returns whether the animation should continue.
 bool    CycleViewAnim(int view, uint16_t &loop, uint16_t &frame, bool forwards, int repeat);
+// Asks the sprite cache to prefetch the frames which the view animation is going
+// to display next, following the same rules as CycleViewAnim.
+void    PrefetchViewAnim(int view, int loop, int frame, bool forwards, int repeat, int lookahead = 2);
 void	CheckViewFrameForObject(RoomObject *obj);
 
 } // namespace AGS3
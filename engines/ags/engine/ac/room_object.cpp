@@ -98,6 +98,7 @@ void RoomObject::UpdateCyclingView(int ref_id) {
 
 	wait = vfptr->speed + overall_speed;
 	CheckViewFrame();
+	PrefetchViewAnim(view, loop, frame, get_anim_forwards(), get_anim_repeat());
 }
 
 // Calculate wanted frame sound volume based on multiple factors
@@ -54,7 +54,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 }
 
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
-	delete _screen;
+	// NOTE: this also releases the screen copy
 	ScummVMRendererGraphicsDriver::UnInit();
 }
 
@@ -145,6 +145,10 @@ void ScummVMRendererGraphicsDriver::UpdateDeviceScreen(const Size &screen_sz) {
 #endif
 }
 
+void ScummVMRendererGraphicsDriver::InvalidateDeviceScreen() {
+	_screenInvalid = true;
+}
+
 void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 	if (!IsNativeSizeValid())
 		return;
@@ -173,6 +177,9 @@ void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
 void ScummVMRendererGraphicsDriver::ReleaseDisplayMode() {
 	OnModeReleased();
 	ClearDrawLists();
+	// Screen copy no longer matches the system screen
+	delete _screen;
+	_screen = nullptr;
 }
 
 bool ScummVMRendererGraphicsDriver::SetNativeResolution(const GraphicResolution &native_res) {
@@ -246,21 +253,29 @@ int ScummVMRendererGraphicsDriver::GetCompatibleBitmapFormat(int color_depth) {
 }
 
 IDriverDependantBitmap *ScummVMRendererGraphicsDriver::CreateDDB(int width, int height, int color_depth, bool opaque) {
-	return new ALSoftwareBitmap(width, height, color_depth, opaque);
+	ALSoftwareBitmap *ddb = new ALSoftwareBitmap(width, height, color_depth, opaque);
+	StampDDB(ddb);
+	return ddb;
 }
 
 IDriverDependantBitmap *ScummVMRendererGraphicsDriver::CreateDDBFromBitmap(Bitmap *bitmap, bool has_alpha, bool opaque) {
-	return new ALSoftwareBitmap(bitmap, has_alpha, opaque);
+	ALSoftwareBitmap *ddb = new ALSoftwareBitmap(bitmap, has_alpha, opaque);
+	StampDDB(ddb);
+	return ddb;
 }
 
 IDriverDependantBitmap *ScummVMRendererGraphicsDriver::CreateRenderTargetDDB(int width, int height, int color_depth, bool opaque) {
-	return new ALSoftwareBitmap(width, height, color_depth, opaque);
+	ALSoftwareBitmap *ddb = new ALSoftwareBitmap(width, height, color_depth, opaque);
+	StampDDB(ddb);
+	return ddb;
 }
 
 void ScummVMRendererGraphicsDriver::UpdateDDBFromBitmap(IDriverDependantBitmap *bitmapToUpdate, Bitmap *bitmap, bool has_alpha) {
 	ALSoftwareBitmap *alSwBmp = (ALSoftwareBitmap *)bitmapToUpdate;
 	alSwBmp->_bmp = bitmap;
 	alSwBmp->_hasAlpha = has_alpha;
+	// The bitmap is usually same, but its pixels were redrawn
+	StampDDB(alSwBmp);
 }
 
 void ScummVMRendererGraphicsDriver::DestroyDDB(IDriverDependantBitmap *bitmap) {
@@ -299,12 +314,14 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 		batch.Surface = desc.Surface;
 		batch.Opaque = true;
 		batch.IsParentRegion = false;
+		batch.RenderedSig.clear();
 	}
 	// In case something was not initialized
 	else if (desc.Viewport.IsEmpty() || !virtualScreen) {
 		batch.Surface.reset();
 		batch.Opaque = false;
 		batch.IsParentRegion = false;
+		batch.RenderedSig.clear();
 	}
 	// Drawing directly on a viewport without transformation (other than offset):
 	// then make a subbitmap of the parent surface (virtualScreen or else).
@@ -319,6 +336,7 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 		}
 		batch.Opaque = true;
 		batch.IsParentRegion = true;
+		batch.RenderedSig.clear();
 		// Because we sub-bitmap to viewport, render offsets should account for that
 		transform.X -= viewport.Left;
 		transform.Y -= viewport.Top;
@@ -328,6 +346,7 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 	else {
 		if (!batch.Surface || batch.IsParentRegion || (batch.Surface->GetSize() != Size(src_w, src_h))) {
 			batch.Surface.reset(new Bitmap(src_w, src_h, _srcColorDepth));
+			batch.RenderedSig.clear();
 		}
 		batch.Opaque = false;
 		batch.IsParentRegion = false;
@@ -390,6 +409,12 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 	// that here would slow things down significantly, so if we ever go that way sprite caching will
 	// be required (similarly to how AGS caches flipped/scaled object sprites now for).
 	//
+	// Batches which draw on their own intermediate surface are compared with what they contained
+	// on the previous frame, and if nothing changed then their surface is only blitted again.
+	// Batches that draw directly on the parent surface are always redrawn, because the engine
+	// restores room background under each sprite prior to rendering.
+	//
+	PrepareBatchReuse();
 
 	const size_t last_batch_to_rend = _spriteBatchDesc.size() - 1;
 	for (size_t cur_bat = 0u, last_bat = 0u, cur_spr = 0u; last_bat <= last_batch_to_rend;) {
@@ -397,8 +422,15 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 		if (cur_spr <= _spriteBatchRange[cur_bat].first) {
 			const auto &batch = _spriteBatches[cur_bat];
 			// Prepare the transparent surface
-			if (batch.Surface && !batch.Opaque)
+			if (batch.Surface && !batch.Opaque && !batch.Reuse && !batch.Skip)
 				batch.Surface->ClearTransparent();
+			// Surface contents are kept, skip all the sprites including nested ones
+			if (batch.Reuse) {
+				const auto &batch_desc = _spriteBatchDesc[cur_bat];
+				Bitmap *parent_surf = ((batch_desc.Parent != UINT32_MAX) && _spriteBatches[batch_desc.Parent].Surface) ? _spriteBatches[batch_desc.Parent].Surface.get() : virtualScreen;
+				parent_surf->SetClip(batch.Viewport);
+				cur_spr = MAX(cur_spr, _spriteBatchRange[cur_bat].second);
+			}
 		}
 
 		// Render immediate batch sprites, if any, update cur_spr iterator
@@ -435,7 +467,7 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 
 			// If we're not drawing directly to the subregion of a parent surface,
 			// then blit our own surface to the parent's
-			if (surface && !batch.IsParentRegion) {
+			if (surface && !batch.IsParentRegion && !batch.Skip) {
 				parent_surf->StretchBlt(surface, viewport, batch.Opaque ? kBitmap_Copy : kBitmap_Transparency);
 			}
 
@@ -455,6 +487,71 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 	ClearDrawLists();
 }
 
+bool ScummVMRendererGraphicsDriver::GetBatchSignature(size_t index, std::vector<uint64_t> &sig) const {
+	sig.resize(0);
+	sig.push_back(_sharedStamp);
+	// Nested batches always follow their parent in the list
+	for (size_t i = index; i < _spriteBatchDesc.size(); ++i) {
+		const auto &desc = _spriteBatchDesc[i];
+		if ((i > index) && ((desc.Parent == UINT32_MAX) || (desc.Parent < index)))
+			break;
+		if ((i > index) && desc.Surface)
+			return false; // drawn by the engine, we can't know when it changes
+		const auto &batch = _spriteBatches[i];
+		uint32_t scale_x, scale_y;
+		memcpy(&scale_x, &batch.Transform.ScaleX, sizeof(scale_x));
+		memcpy(&scale_y, &batch.Transform.ScaleY, sizeof(scale_y));
+		sig.push_back(((uint64_t)(i - index) << 32) | (uint32_t)(desc.Parent - index));
+		sig.push_back(((uint64_t)(uint32_t)batch.Viewport.Left << 32) | (uint32_t)batch.Viewport.Top);
+		sig.push_back(((uint64_t)(uint32_t)batch.Viewport.Right << 32) | (uint32_t)batch.Viewport.Bottom);
+		sig.push_back(((uint64_t)(uint32_t)batch.Transform.X << 32) | (uint32_t)batch.Transform.Y);
+		sig.push_back(((uint64_t)scale_x << 32) | scale_y);
+	}
+
+	const auto &range = _spriteBatchRange[index];
+	for (size_t i = range.first; (i < range.second) && (i < _spriteList.size()); ++i) {
+		const auto &sprite = _spriteList[i];
+		if (sprite.ddb == nullptr)
+			return false; // plugin callback, may draw anything
+		sig.push_back(((uint64_t)(sprite.node - index) << 32) | (uint32_t)sprite.x);
+		if (sprite.ddb == reinterpret_cast<ALSoftwareBitmap *>(DRAWENTRY_TINT)) {
+			sig.push_back(((uint64_t)(uint32_t)sprite.y << 32) | 0xFFFFFFFFu);
+			sig.push_back(((uint64_t)(uint32_t)_tint_red << 32) | ((uint32_t)_tint_green << 16) | (uint32_t)_tint_blue);
+			continue;
+		}
+		const ALSoftwareBitmap *bitmap = sprite.ddb;
+		sig.push_back(((uint64_t)(uint32_t)sprite.y << 32) | bitmap->_stamp);
+		sig.push_back((uint64_t)(uintptr_t)bitmap);
+		sig.push_back((uint64_t)(uintptr_t)bitmap->_bmp);
+		sig.push_back(((uint64_t)(uint32_t)bitmap->_alpha << 32) | (bitmap->_opaque ? 1u : 0u) | (bitmap->_hasAlpha ? 2u : 0u));
+	}
+	return true;
+}
+
+void ScummVMRendererGraphicsDriver::PrepareBatchReuse() {
+	for (size_t i = 0; i < _spriteBatchDesc.size(); ++i) {
+		auto &batch = _spriteBatches[i];
+		const auto &desc = _spriteBatchDesc[i];
+		batch.Reuse = false;
+		batch.Skip = (desc.Parent != UINT32_MAX) &&
+			(_spriteBatches[desc.Parent].Reuse || _spriteBatches[desc.Parent].Skip);
+		// A skipped batch keeps its surface untouched, and so its signature
+		if (batch.Skip || !batch.Surface || batch.IsParentRegion || desc.Surface)
+			continue;
+
+		if (!GetBatchSignature(i, _batchSig)) {
+			batch.RenderedSig.clear();
+			continue;
+		}
+		if (!batch.RenderedSig.empty() && (batch.RenderedSig == _batchSig)) {
+			batch.Reuse = true;
+		} else {
+			// Surface will be redrawn now
+			batch.RenderedSig.swap(_batchSig);
+		}
+	}
+}
+
 size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &batch, size_t from, Bitmap *surface, int surf_offx, int surf_offy) {
 	for (; (from < _spriteList.size()) && (_spriteList[from].node == batch.ID); ++from) {
 		const auto &sprite = _spriteList[from];
@@ -533,6 +630,43 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+void ScummVMRendererGraphicsDriver::copySurfaceDirty(const Graphics::Surface &src) {
+	assert(src.w == _screen->w && src.h == _screen->h && src.format == _screen->format);
+	// Compare the frame in tiles, and join horizontally adjacent changed tiles,
+	// so that a mostly static screen results in few and small dirty rects
+	const int tileSize = 64;
+	const int bpp = src.format.bytesPerPixel;
+	const int tileCols = (src.w + tileSize - 1) / tileSize;
+
+	for (int ty = 0; ty < src.h; ty += tileSize) {
+		const int th = MIN(tileSize, src.h - ty);
+		int dirtyFrom = -1;
+		// NOTE: iterate one column past the last, to flush the pending rect
+		for (int col = 0; col <= tileCols; ++col) {
+			const int tx = col * tileSize;
+			bool changed = false;
+			if (col < tileCols) {
+				const int tw = MIN(tileSize, src.w - tx);
+				for (int y = ty; y < ty + th; ++y) {
+					const byte *srcP = (const byte *)src.getBasePtr(tx, y);
+					byte *destP = (byte *)_screen->getBasePtr(tx, y);
+					if (changed || memcmp(srcP, destP, tw * bpp) != 0) {
+						memcpy(destP, srcP, tw * bpp);
+						changed = true;
+					}
+				}
+			}
+
+			if (changed && dirtyFrom < 0) {
+				dirtyFrom = tx;
+			} else if (!changed && dirtyFrom >= 0) {
+				_screen->addDirtyRect(Common::Rect(dirtyFrom, ty, MIN(tx, (int)src.w), ty + th));
+				dirtyFrom = -1;
+			}
+		}
+	}
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -583,7 +717,7 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		renderMode = kRenderOther;
 	}
 
-	if (renderMode != kRenderDirect && !_screen)
+	if (!_screen)
 		_screen = new Graphics::Screen();
 
 	switch (renderMode) {
@@ -608,15 +742,9 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	}
 
 	case kRenderDirect:
-		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
-		g_system->updateScreen();
-		if (srcTransformed) {
-			srcTransformed->free();
-			delete srcTransformed;
-		}
-		return;
+		// The virtual surface is in the screen format, only pass the changed parts
+		copySurfaceDirty(src);
+		break;
 
 	default:
 		break;
@@ -627,6 +755,14 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		delete srcTransformed;
 	}
 
+	// The copies above only send what differs from _screen, which does not
+	// reflect anything drawn to the system screen by others. The overlay
+	// is checked here too, in case the backend does not restore the screen.
+	if (_screenInvalid || g_system->isOverlayVisible()) {
+		_screen->makeAllDirty();
+		_screenInvalid = g_system->isOverlayVisible();
+	}
+
 	if (_screen)
 		_screen->update();
 }
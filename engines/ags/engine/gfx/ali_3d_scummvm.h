@@ -81,6 +81,8 @@ public:
 	bool _flipped = false;
 	int _stretchToWidth = 0, _stretchToHeight = 0;
 	int _alpha = 255;
+	// Content stamp, renewed by the driver each time the bitmap is (re)assigned
+	uint32_t _stamp = 0u;
 
 	ALSoftwareBitmap(int width, int height, int color_depth, bool opaque) {
 		_width = width;
@@ -151,6 +153,13 @@ struct ALSpriteBatch {
 	bool IsParentRegion = false;
 	// Tells whether the surface is treated as opaque or transparent
 	bool Opaque = false;
+	// Signature of the batch contents last rendered on the exclusive Surface;
+	// empty if the surface contents are unknown or could not be described
+	std::vector<uint64_t> RenderedSig;
+	// Surface is kept from the previous frame, because signature did not change
+	bool Reuse = false;
+	// One of the parent batches is reused, so this one is not rendered at all
+	bool Skip = false;
 };
 typedef std::vector<ALSpriteBatch> ALSpriteBatches;
 
@@ -176,6 +185,7 @@ public:
 	void SetTintMethod(TintMethod /*method*/) override;
 	bool SetDisplayMode(const DisplayMode &mode) override;
 	void UpdateDeviceScreen(const Size &screen_sz) override;
+	void InvalidateDeviceScreen() override;
 	bool SetNativeResolution(const GraphicResolution &native_res) override;
 	bool SetRenderFrame(const Rect &dst_rect) override;
 	bool IsModeSupported(const DisplayMode &mode) override;
@@ -203,10 +213,11 @@ public:
 	}
 
 	void UpdateSharedDDB(uint32_t /*sprite_id*/, Bitmap */*bitmap*/, bool /*has_alpha*/, bool /*opaque*/) override {
-		/* do nothing */
+		// shared DDBs are not tracked by id, so invalidate all the cached batches
+		++_sharedStamp;
 	}
 	void ClearSharedDDB(uint32_t /*sprite_id*/) override {
-		/* do nothing */
+		++_sharedStamp;
 	}
 
 	void DrawSprite(int x, int y, IDriverDependantBitmap *ddb) override;
@@ -249,6 +260,8 @@ protected:
 
 private:
 	Graphics::Screen *_screen = nullptr;
+	// Whether the system screen may differ from _screen, so all of it has to be sent
+	bool _screenInvalid = false;
 	PSDLRenderFilter _filter;
 
 	bool _hasGamma = false;
@@ -282,6 +295,12 @@ private:
 	ALSpriteBatches _spriteBatches;
 	// List of sprites to render
 	std::vector<ALDrawListEntry> _spriteList;
+	// Last assigned bitmap content stamp
+	uint32_t _ddbStamp = 0u;
+	// Counts updates of shared DDBs, which contents are changed behind our back
+	uint32_t _sharedStamp = 0u;
+	// Temporary signature used when testing batches for reuse
+	std::vector<uint64_t> _batchSig;
 
 	void InitSpriteBatch(size_t index, const SpriteBatchDesc &desc) override;
 	void ResetAllBatches() override;
@@ -291,6 +310,16 @@ private:
 	void DestroyVirtualScreen();
 	// Unset parameters and release resources related to the display mode
 	void ReleaseDisplayMode();
+	// Assigns a new content stamp to the bitmap
+	void StampDDB(ALSoftwareBitmap *bitmap) {
+		bitmap->_stamp = ++_ddbStamp;
+	}
+	// Describes the batch and all its nested batches and sprites, for comparing
+	// with the previous frame; returns false if the contents cannot be described
+	// (e.g. plugin draws or externally provided surfaces are involved)
+	bool GetBatchSignature(size_t index, std::vector<uint64_t> &sig) const;
+	// Tests which exclusive batch surfaces may be kept from the previous frame
+	void PrepareBatchReuse();
 	// Renders single sprite batch on the precreated surface
 	size_t RenderSpriteBatch(const ALSpriteBatch &batch, size_t from, Shared::Bitmap *surface, int surf_offx, int surf_offy);
 
@@ -300,6 +329,8 @@ private:
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	// Copy raw screen bitmap pixels to the screen
 	void copySurface(const Graphics::Surface &src, bool mode);
+	// Copy only the regions of the screen which differ from the last presented frame
+	void copySurfaceDirty(const Graphics::Surface &src);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
@@ -117,6 +117,9 @@ public:
 	virtual bool SetDisplayMode(const DisplayMode &mode) = 0;
 	// Updates previously set display mode, accommodating to the new screen size
 	virtual void UpdateDeviceScreen(const Size &screen_size) = 0;
+	// Tells the driver that the device screen was drawn to behind its back
+	// (e.g. by video playback), so the next frame has to be presented in full
+	virtual void InvalidateDeviceScreen() = 0;
 	// Gets if a graphics mode was initialized
 	virtual bool IsModeSet() const = 0;
 	// Set the size of the native image size
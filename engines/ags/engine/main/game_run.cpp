@@ -89,6 +89,9 @@ static bool ShouldStayInWaitMode();
 #define UNTIL_INTISNEG  8
 #define UNTIL_ANIMBTNEND 9
 
+// Max number of queued sprites loaded ahead of use after each rendered frame
+#define SPRITE_PREFETCH_PER_FRAME 4
+
 static void ProperExit() {
 	_G(want_exit) = false;
 	_G(proper_exit) = 1;
@@ -860,8 +863,11 @@ void UpdateGameOnce(bool checkControls, IDriverDependantBitmap *extraBitmap, int
 	update_audio_system_on_game_loop();
 
 	// Only render if we are not skipping a cutscene
-	if (!_GP(play).fast_forward)
+	if (!_GP(play).fast_forward) {
 		render_graphics(extraBitmap, extraX, extraY);
+		// load few of the sprites which animations are going to show next
+		_GP(spriteset).ProcessPrefetch(SPRITE_PREFETCH_PER_FRAME);
+	}
 
 	set_our_eip(6);
 
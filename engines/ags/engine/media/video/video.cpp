@@ -130,14 +130,19 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 						do_break = true;  // skip on any key
 				}
 			}
-			if (do_break)
+			if (do_break) {
+				_G(gfxDriver)->InvalidateDeviceScreen();
 				return true; // skip on key press
-			if (run_service_mb_controls(mbut, mwheelz) && mbut >= kMouseNone && skip == VideoSkipKeyOrMouse)
+			}
+			if (run_service_mb_controls(mbut, mwheelz) && mbut >= kMouseNone && skip == VideoSkipKeyOrMouse) {
+				_G(gfxDriver)->InvalidateDeviceScreen();
 				return true; // skip on mouse click
+			}
 		}
 	}
 
 	// Clear the screen after playback
+	_G(gfxDriver)->InvalidateDeviceScreen();
 	if (_G(gfxDriver)->UsesMemoryBackBuffer())
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
 	render_to_screen();
@@ -253,6 +253,7 @@ ccInstance::ccInstance() {
 	numimports = 0;
 	resolved_imports = nullptr;
 	code_fixups         = nullptr;
+	code_ops            = nullptr;
 
 	memset(callStackLineNumber, 0, sizeof(callStackLineNumber));
 	memset(callStackAddr, 0, sizeof(callStackAddr));
@@ -560,7 +561,7 @@ int ccInstance::Run(int32_t curpc) {
 	thisbase[0] = 0;
 	funcstart[0] = pc;
 	ccInstance *codeInst = runningInst;
-	ScriptOperation codeOp;
+	const ScriptCodeOp *codeOps = codeInst->code_ops;
 	FunctionCallStack func_callstack;
 #if DEBUG_CC_EXEC
 	const bool dump_opcodes = (ccGetOption(SCOPT_DEBUGRUN) != 0) ||
@@ -583,47 +584,23 @@ int ccInstance::Run(int32_t curpc) {
 		//
 		/* Read operation */
 		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
-
-		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
-							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
-
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
-
-		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
-							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
-
-
-		// Read arguments; use switch as it proved to be faster than the loop
-
-		switch (codeOp.ArgCount) {
-		case 3:
-			codeOp.Args[2].SetInt32(static_cast<int32_t>(codeInst->code[pc + 3]));
-			/* fall-through */
-		case 2:
-			codeOp.Args[1].SetInt32(static_cast<int32_t>(codeInst->code[pc + 2]));
-			/* fall-through */
-		case 1:
-			codeOp.Args[0].SetInt32(static_cast<int32_t>(codeInst->code[pc + 1]));
-			break;
-		default:
-			break;
-		}
-		//---------------------------------------------------------------------
-		/* End read operation */
-		//=====================================================================
+		// The instruction was decoded and validated beforehand, see CreateCodeOps()
+		const ScriptCodeOp &codeOp = codeOps[pc];
 
 #if (DEBUG_CC_EXEC)
 		if (dump_opcodes) {
-			DumpInstruction(codeOp);
+			ScriptOperation dumpOp;
+			dumpOp.Instruction = ScriptInstruction(codeOp.Code, codeOp.InstanceId);
+			dumpOp.ArgCount = codeOp.ArgCount;
+			for (int i = 0; i < codeOp.ArgCount; ++i)
+				dumpOp.Args[i].SetInt32(codeOp.Args[i]);
+			DumpInstruction(dumpOp);
 		}
 #endif
 
 		/* Perform operation */
 		//=====================================================================
-		switch (codeOp.Instruction.Code) {
+		switch (codeOp.Code) {
 		case SCMD_LINENUM:
 			line_number = codeOp.Arg1i();
 			_G(currentline) = line_number;
@@ -692,9 +669,9 @@ int ccInstance::Run(int32_t curpc) {
 			// be only up to 4 bytes large;
 			// I guess that's an obsolete way to do WRITE, WRITEW and WRITEB
 			const auto arg_size = codeOp.Arg1i();
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			RuntimeScriptValue arg_value(codeOp.Arg2i());
+			FixupArgument(arg_value, codeOp.Arg2Fixup, codeInst->code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
 			switch (arg_size) {
 			case sizeof(char):
 				registers[SREG_MAR].WriteByte(arg_value.IValue);
@@ -729,9 +706,9 @@ int ccInstance::Run(int32_t curpc) {
 		}
 		case SCMD_LITTOREG: {
 			auto &reg1 = registers[codeOp.Arg1i()];
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			RuntimeScriptValue arg_value(codeOp.Arg2i());
+			FixupArgument(arg_value, codeOp.Arg2Fixup, codeInst->code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
 			reg1 = arg_value;
 			break;
 		}
@@ -1158,7 +1135,7 @@ int ccInstance::Run(int32_t curpc) {
 			ccInstance *wasRunning = runningInst;
 
 			// extract the instance ID
-			int32_t instId = codeOp.Instruction.InstanceId;
+			int32_t instId = codeOp.InstanceId;
 			// determine the offset into the code of the instance we want
 			runningInst = _G(loadedInstances)[instId];
 			uintptr_t callAddr = reg1.PtrU8 - reinterpret_cast<uint8_t *>(&runningInst->code[0]);
@@ -1318,7 +1295,7 @@ int ccInstance::Run(int32_t curpc) {
 		case SCMD_NEWARRAY: {
 			auto &reg1 = registers[codeOp.Arg1i()];
 			const auto arg_elsize = codeOp.Arg2i();
-			const auto arg_managed = codeOp.Arg3().GetAsBool();
+			const auto arg_managed = (codeOp.Arg3i() != 0);
 			int numElements = reg1.IValue;
 			if (numElements < 1) {
 				cc_error("invalid size for dynamic array; requested: %d, range: 1..%d", numElements, INT32_MAX);
@@ -1457,8 +1434,16 @@ int ccInstance::Run(int32_t curpc) {
 			if (loopIterationCheckDisabled == 0)
 				loopIterationCheckDisabled++;
 			break;
+		case ScriptCodeOp::kScInvalidOp: {
+			const int32_t instr = static_cast<int32_t>(codeInst->code[pc] & INSTANCE_ID_REMOVEMASK);
+			if (instr >= CC_NUM_SCCMDS)
+				cc_error("invalid instruction %d found in code stream", instr);
+			else
+				cc_error("unexpected end of code data (%d; %d)", pc + (*g_commands)[instr].ArgCount, codeInst->codesize);
+			return -1;
+		}
 		default:
-			cc_error("instruction %d is not implemented", codeOp.Instruction.Code);
+			cc_error("instruction %d is not implemented", codeOp.Code);
 			return -1;
 		}
 		/* End perform operation */
@@ -1651,6 +1636,7 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 	if (joined) {
 		resolved_imports = joined->resolved_imports;
 		code_fixups = joined->code_fixups;
+		code_ops = joined->code_ops;
 	} else {
 		if (!CreateGlobalVars(scri.get())) {
 			return false;
@@ -1658,6 +1644,7 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 		if (!CreateRuntimeCodeFixups(scri.get())) {
 			return false;
 		}
+		CreateCodeOps();
 	}
 
 	exports = new RuntimeScriptValue[scri->numexports];
@@ -1737,9 +1724,11 @@ void ccInstance::Free() {
 	if ((flags & INSTF_SHAREDATA) == 0) {
 		delete[] resolved_imports;
 		delete[] code_fixups;
+		delete[] code_ops;
 	}
 	resolved_imports = nullptr;
 	code_fixups = nullptr;
+	code_ops = nullptr;
 }
 
 bool ccInstance::ResolveScriptImports(const ccScript *scri) {
@@ -1945,14 +1934,56 @@ bool ccInstance::ResolveImportFixups(const ccScript *scri) {
 			return false;
 		}
 		code[fixup] = import_index;
+		UpdateCodeOps(fixup);
 		// If the call is to another script function next CALLEXT
 		// must be replaced with CALLAS
-		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT)
+		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT) {
 			code[fixup + 1] = SCMD_CALLAS | (import->InstancePtr->loadedInstanceId << INSTANCE_ID_SHIFT);
+			UpdateCodeOps(fixup + 1);
+		}
 	}
 	return true;
 }
 
+// Decodes a single instruction at the given code position
+static void DecodeCodeOp(ScriptCodeOp &op, const intptr_t *code, const char *code_fixups, const int32_t codesize, const int32_t at_pc) {
+	const int32_t instr = static_cast<int32_t>(code[at_pc]);
+	const int32_t op_code = instr & INSTANCE_ID_REMOVEMASK;
+	op = ScriptCodeOp();
+	if (op_code >= CC_NUM_SCCMDS)
+		return; // invalid instruction
+	const int arg_count = (*g_commands)[op_code].ArgCount;
+	if (at_pc + arg_count >= codesize)
+		return; // unexpected end of code data
+
+	op.Code = static_cast<uint8_t>(op_code);
+	op.InstanceId = static_cast<uint8_t>((instr >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK);
+	op.ArgCount = static_cast<uint8_t>(arg_count);
+	for (int i = 0; i < arg_count; ++i)
+		op.Args[i] = static_cast<int32_t>(code[at_pc + 1 + i]);
+	if (arg_count >= 2)
+		op.Arg2Fixup = static_cast<uint8_t>(code_fixups[at_pc + 2]);
+}
+
+void ccInstance::CreateCodeOps() {
+	delete[] code_ops;
+	code_ops = nullptr;
+	if (codesize <= 0)
+		return;
+
+	code_ops = new ScriptCodeOp[codesize];
+	for (int32_t i = 0; i < codesize; ++i)
+		DecodeCodeOp(code_ops[i], code, code_fixups, codesize, i);
+}
+
+void ccInstance::UpdateCodeOps(const int32_t at_pc) {
+	if (!code_ops)
+		return;
+	// the instruction itself and any preceding ones that may take it as an argument
+	for (int32_t i = std::max(0, at_pc - MAX_SCMD_ARGS); i <= at_pc && i < codesize; ++i)
+		DecodeCodeOp(code_ops[i], code, code_fixups, codesize, i);
+}
+
 void ccInstance::PushValueToStack(const RuntimeScriptValue &rval) {
 	// Write value to the stack tail and advance stack ptr
 	registers[SREG_SP].WriteValue(rval);
@@ -83,6 +83,27 @@ struct ScriptOperation {
 	inline int Arg3i() const { return Args[2].IValue; }
 };
 
+// Pre-decoded script instruction.
+// ccInstance translates its code array into a table of these once all the
+// fixups and imports are resolved, one entry per code position, so that the
+// executor does not have to unpack, validate and convert the operands on
+// every step. Positions that do not hold a valid instruction are marked with
+// kScInvalidOp and reported only if the execution actually reaches them.
+struct ScriptCodeOp {
+	static const uint8_t kScInvalidOp = 0xFF;
+
+	uint8_t Code = kScInvalidOp; // pure instruction code
+	uint8_t InstanceId = 0;      // instance id, used by the far calls
+	uint8_t ArgCount = 0;
+	uint8_t Arg2Fixup = 0;       // fixup type of the 2nd argument, if any
+	int32_t Args[MAX_SCMD_ARGS] = {};
+
+	// returns argN as a integer literal
+	inline int Arg1i() const { return Args[0]; }
+	inline int Arg2i() const { return Args[1]; }
+	inline int Arg3i() const { return Args[2]; }
+};
+
 struct ScriptVariable {
 	ScriptVariable() {
 		ScAddress = -1; // address = 0 is valid one, -1 means undefined
@@ -154,6 +175,8 @@ public:
 	int  numimports;
 
 	char *code_fixups;
+	// pre-decoded instructions, one per code position
+	ScriptCodeOp *code_ops;
 
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
@@ -208,6 +231,10 @@ private:
 	bool    AddGlobalVar(const ScriptVariable &glvar);
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(const ccScript *scri);
+	// Translates code array into the table of pre-decoded instructions
+	void    CreateCodeOps();
+	// Updates pre-decoded instructions which include the given code position
+	void    UpdateCodeOps(int32_t at_pc);
 
 	// Begin executing script starting from the given bytecode index
 	int     Run(int32_t curpc);
@@ -47,6 +47,10 @@ using namespace AGS::Shared;
 #define SPRCACHEFLAG_ERROR	  0x04
 // Locked sprites are ones that should not be freed when out of cache space.
 #define SPRCACHEFLAG_LOCKED	  0x08
+// Tells that the sprite is queued for prefetching
+#define SPRCACHEFLAG_PREFETCH 0x10
+// Tells that the sprite was prefetched and was not requested yet
+#define SPRCACHEFLAG_PREFETCHED 0x20
 
 // High-verbosity sprite cache log
 #if DEBUG_SPRITECACHE
@@ -104,6 +108,7 @@ void SpriteCache::Reset() {
 	_file.Close();
 	_spriteData.clear();
 	_mru.clear();
+	_prefetch.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
 }
@@ -227,10 +232,16 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 		return _spriteData[index].Image.get();
 	// Either use ready image, or load one from assets
 	if (_spriteData[index].Image) {
+		_stats.Hits++;
+		if ((_spriteData[index].Flags & SPRCACHEFLAG_PREFETCHED) != 0) {
+			_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCHED;
+			_stats.PrefetchHits++;
+		}
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
 		return _spriteData[index].Image.get();
 	} else {
+		_stats.Misses++;
 		// Sprite exists in file but is not in mem, load it and add to MRU list
 		if (LoadSprite(index)) {
 			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
@@ -275,6 +286,8 @@ void SpriteCache::DisposeOldest() {
 	// NOTE: locked sprites may still occur in MRU list
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
+		_stats.Disposals++;
+		_stats.DisposedBytes += _spriteData[sprnum].Size;
 		_spriteData[sprnum].Image.reset();
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
@@ -303,6 +316,7 @@ void SpriteCache::DisposeAllFreeCached() {
 	}
 	_cacheSize = _lockedSize;
 	_mru.clear();
+	ClearPrefetch();
 }
 
 void SpriteCache::PrecacheSprite(sprkey_t index) {
@@ -331,6 +345,68 @@ void SpriteCache::PrecacheSprite(sprkey_t index) {
 	SprCacheLog("Precached %d", index);
 }
 
+void SpriteCache::PrefetchSprite(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return;
+	const SpriteData &spr = _spriteData[index];
+	if (!spr.IsAssetSprite() || spr.IsError() || spr.Image ||
+		((spr.Flags & SPRCACHEFLAG_PREFETCH) != 0))
+		return; // not an asset, already in memory or queued
+
+	_spriteData[index].Flags |= SPRCACHEFLAG_PREFETCH;
+	_prefetch.push_back(index);
+}
+
+void SpriteCache::ProcessPrefetch(size_t max_count) {
+	size_t i = 0;
+	for (; (i < _prefetch.size()) && (max_count > 0); ++i) {
+		const sprkey_t index = _prefetch[i];
+		if ((size_t)index >= _spriteData.size())
+			continue; // the sprite bank was shrunk meanwhile
+		_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCH;
+		if (!_spriteData[index].IsAssetSprite() || _spriteData[index].IsError() ||
+			_spriteData[index].Image)
+			continue; // deleted, failed or loaded since the request
+		// Don't let prefetching push out the sprites that are in use
+		if (_cacheSize + GetSpriteSizeEstimate(index) >= _maxCacheSize)
+			continue;
+
+		if (LoadSprite(index)) {
+			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
+			_spriteData[index].Flags |= SPRCACHEFLAG_PREFETCHED;
+			_stats.Prefetched++;
+		}
+		max_count--;
+	}
+	_prefetch.erase(_prefetch.begin(), _prefetch.begin() + i);
+}
+
+void SpriteCache::ClearPrefetch() {
+	for (const auto index : _prefetch) {
+		if ((size_t)index < _spriteData.size())
+			_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCH;
+	}
+	_prefetch.clear();
+}
+
+size_t SpriteCache::GetPrefetchQueueSize() const {
+	return _prefetch.size();
+}
+
+const SpriteCache::Stats &SpriteCache::GetStats() const {
+	return _stats;
+}
+
+void SpriteCache::ResetStats() {
+	_stats = Stats();
+}
+
+size_t SpriteCache::GetSpriteSizeEstimate(sprkey_t index) const {
+	// The final color depth is only known after the sprite is initialized,
+	// so assume the largest one
+	return _sprInfos[index].Width * _sprInfos[index].Height * 4;
+}
+
 void SpriteCache::LockSprite(sprkey_t index) {
 	assert(index >= 0); // out of positive range indexes are valid to fail
 	if (index < 0 || (size_t)index >= _spriteData.size())
@@ -394,6 +470,8 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 	_spriteData[index] = SpriteData(image, size, SPRCACHEFLAG_ISASSET);
 	_spriteData[index].Flags |= (SPRCACHEFLAG_LOCKED * should_lock);
 	_cacheSize += size;
+	_stats.Loads++;
+	_stats.LoadedBytes += size;
 	SprCacheLog("Loaded %d, size now %zu KB", index, _cacheSize / 1024);
 
 	// Let the external user to react to the new sprite;
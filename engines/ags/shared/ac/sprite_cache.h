@@ -95,6 +95,18 @@ public:
 		PfnPrewriteSprite PrewriteSprite;
 	};
 
+	// Cache usage statistics, for diagnostic purposes
+	struct Stats {
+		size_t Hits = 0u;          // requested sprite was in memory
+		size_t Misses = 0u;        // requested sprite had to be loaded
+		size_t Loads = 0u;         // number of sprites loaded from the file
+		size_t LoadedBytes = 0u;   // total size of loaded sprites
+		size_t Disposals = 0u;     // number of sprites disposed to free space
+		size_t DisposedBytes = 0u; // total size of disposed sprites
+		size_t Prefetched = 0u;    // number of sprites loaded ahead of use
+		size_t PrefetchHits = 0u;  // prefetched sprites which were used later
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks);
 	~SpriteCache() = default;
 
@@ -138,6 +150,20 @@ public:
 	// Loads sprite using SpriteFile if such index is known,
 	// frees the space if cache size reaches the limit
 	void        PrecacheSprite(sprkey_t index);
+	// Queues asset sprite for loading ahead of its use; does nothing if the
+	// sprite is already in memory or queued.
+	void        PrefetchSprite(sprkey_t index);
+	// Loads up to max_count queued sprites, as long as they fit into the
+	// free cache space; prefetching never disposes any cached sprites.
+	void        ProcessPrefetch(size_t max_count);
+	// Drops all the pending prefetch requests
+	void        ClearPrefetch();
+	// Returns number of pending prefetch requests
+	size_t      GetPrefetchQueueSize() const;
+	// Returns cache usage statistics
+	const Stats &GetStats() const;
+	// Resets cache usage statistics
+	void        ResetStats();
 	// Locks sprite, preventing it from getting removed by the normal cache limit.
 	// If this is a registered sprite from the game assets, then loads it first.
 	// If this is a sprite with SPRCACHEFLAG_EXTERNAL flag, then does nothing,
@@ -183,6 +209,8 @@ private:
 	size_t      LoadSprite(sprkey_t index, bool lock = false);
 	// Remap the given index to the placeholder
 	void        RemapSpriteToPlaceholder(sprkey_t index);
+	// Estimates the memory size of the asset sprite before it's loaded
+	size_t      GetSpriteSizeEstimate(sprkey_t index) const;
 	// Delete the oldest (least recently used) image in cache
 	void        DisposeOldest();
 	// Keep disposing oldest elements until cache has at least the given free space
@@ -245,6 +273,9 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	// Sprites requested to be loaded ahead of their use, in request order
+	std::vector<sprkey_t> _prefetch;
+	Stats _stats;
 };
 
 } // namespace Shared
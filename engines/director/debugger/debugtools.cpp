@@ -311,6 +311,7 @@ void onImGuiInit() {
 	_state->_archive.memEdit.ReadOnly = true;
 
 	_state->_logger = new ImGuiEx::ImGuiLogger;
+	_state->_profiler = new ImGuiEx::ImGuiProfiler;
 
 	Common::setLogWatcher(onLog);
 }
@@ -360,6 +361,7 @@ void onImGuiRender() {
 			ImGui::MenuItem("Vars", NULL, &_state->_w.vars);
 			ImGui::MenuItem("Watched Vars", NULL, &_state->_w.watchedVars);
 			ImGui::MenuItem("Logger", NULL, &_state->_w.logger);
+			ImGui::MenuItem("Profiler", NULL, &_state->_w.profiler);
 			ImGui::MenuItem("Archive", NULL, &_state->_w.archive);
 
 			ImGui::SeparatorText("Misc");
@@ -390,6 +392,7 @@ void onImGuiRender() {
 	showArchive();
 	showWatchedVars();
 	_state->_logger->draw("Logger", &_state->_w.logger);
+	_state->_profiler->draw("Profiler", &_state->_w.profiler);
 }
 
 void onImGuiCleanup() {
@@ -398,6 +401,7 @@ void onImGuiCleanup() {
 		free(_state->_archive.data);
 
 		delete _state->_logger;
+		delete _state->_profiler;
 	}
 
 	delete _state;
@@ -676,21 +676,39 @@ void LC::cb_thepush2() {
 }
 
 void LC::cb_varpush() {
+	int slot = g_lingo->readInt();
 	Common::String name = g_lingo->readString();
+	debugC(3, kDebugLingoExec, "cb_varpush: pushing %s to stack", name.c_str());
+
+	const Datum *local = g_lingo->findLocalSlot(slot);
+	if (local) {
+		g_debugger->varReadHook(name);
+		g_lingo->push(*local);
+		return;
+	}
+
 	Datum target(name);
 	target.type = LOCALREF;
-	debugC(3, kDebugLingoExec, "cb_varpush: pushing %s to stack", name.c_str());
 	Datum result = g_lingo->varFetch(target);
 	g_lingo->push(result);
 }
 
 
 void LC::cb_varassign() {
+	int slot = g_lingo->readInt();
 	Common::String name = g_lingo->readString();
-	Datum target(name);
-	target.type = LOCALREF;
 	debugC(3, kDebugLingoExec, "cb_varassign: assigning to %s", name.c_str());
 	Datum source = g_lingo->pop();
+
+	Datum *local = g_lingo->findLocalSlot(slot);
+	if (local) {
+		*local = source;
+		g_debugger->varWriteHook(name);
+		return;
+	}
+
+	Datum target(name);
+	target.type = LOCALREF;
 	// Local variables should be initialised by the script, no varCreate here
 	g_lingo->varAssign(target, source);
 }
@@ -1507,6 +1525,7 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 				if (argc) {
 					bool codeName = false;
 					int arg = 0;
+					int slot = -1;
 					for (uint c = 0; c < argc; c++) {
 						switch (g_lingo->_lingoV4[opcode]->proto[c]) {
 						case 'b':
@@ -1554,6 +1573,7 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 							break;
 						case 'a':
 							// argument is a function argument ID
+							slot = arg < (int)argNames->size() ? arg : -1;
 							if (argMap.contains(arg)) {
 								arg = argMap[arg];
 							} else {
@@ -1562,7 +1582,8 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 							}
 							break;
 						case 'v':
-							// argument is a local variable ID
+							// argument is a local variable ID, its slot follows the arguments
+							slot = arg < (int)varNames->size() ? (int)argNames->size() + arg : -1;
 							if (varMap.contains(arg)) {
 								arg = varMap[arg];
 							} else {
@@ -1582,6 +1603,11 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 							break;
 						}
 					}
+					if (slot != -1) {
+						// index into the frame's local slots, the name
+						// is kept for frames without them
+						codeInt(slot);
+					}
 					if (codeName) {
 						codeString(_assemblyArchive->getName(arg).c_str());
 					} else {
@@ -83,6 +83,7 @@ void c_varpush();
 void c_globalinit();
 void c_globalpush();
 void c_localpush();
+void c_localassign();
 void c_proppush();
 void c_argcpush();
 void c_argcnoretpush();
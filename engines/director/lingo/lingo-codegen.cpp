@@ -110,6 +110,7 @@ LingoCompiler::LingoCompiler() {
 
 	_indef = false;
 	_methodVars = nullptr;
+	_methodSlots = nullptr;
 
 	_linenumber = _colnumber = _bytenumber = 0;
 	_lines[0] = _lines[1] = _lines[2] = nullptr;
@@ -136,6 +137,9 @@ ScriptContext *LingoCompiler::compileLingo(const Common::U32String &code, LingoA
 	_currentAssembly = new ScriptData;
 
 	_methodVars = new VarTypeHash;
+	// Left over when compiling a handler failed
+	delete _methodSlots;
+	_methodSlots = nullptr;
 	_linenumber = _colnumber = 1;
 	_hadError = false;
 
@@ -339,6 +343,13 @@ int LingoCompiler::codeFunc(const Common::String &s, int numpar) {
 
 void LingoCompiler::codeVarSet(const Common::String &name) {
 	registerMethodVar(name);
+	VarType type = (*_methodVars)[name];
+	if (type == kVarLocal || type == kVarArgument) {
+		code1(LC::c_localassign);
+		codeInt(getMethodVarSlot(name));
+		codeString(name.c_str());
+		return;
+	}
 	codeVarRef(name);
 	code1(LC::c_assign);
 }
@@ -388,6 +399,7 @@ void LingoCompiler::codeVarGet(const Common::String &name) {
 	case kVarLocal:
 	case kVarArgument:
 		code1(LC::c_localpush);
+		codeInt(getMethodVarSlot(name));
 		break;
 	case kVarProperty:
 	case kVarInstance:
@@ -397,12 +409,25 @@ void LingoCompiler::codeVarGet(const Common::String &name) {
 	codeString(name.c_str());
 }
 
+int LingoCompiler::getMethodVarSlot(const Common::String &name) {
+	if (!_methodSlots)
+		return -1;
+
+	for (uint i = 0; i < _methodSlots->size(); i++) {
+		if ((*_methodSlots)[i].equalsIgnoreCase(name))
+			return i;
+	}
+	return -1;
+}
+
 void LingoCompiler::registerMethodVar(const Common::String &name, VarType type) {
 	if (!_methodVars->contains(name)) {
 		if (_indef && type == kVarGeneric) {
 			type = kVarLocal;
 		}
 		(*_methodVars)[name] = type;
+		if (type == kVarLocal && _methodSlots)
+			_methodSlots->push_back(name);
 		if (type == kVarProperty || type == kVarInstance) {
 			if (!_assemblyContext->hasProp(name))
 				_assemblyContext->setProp(name, Datum(), true);
@@ -480,13 +505,21 @@ bool LingoCompiler::visitHandlerNode(HandlerNode *node) {
 	_currentAssembly = new ScriptData;
 	VarTypeHash *mainMethodVars = _methodVars;
 	_methodVars = new VarTypeHash;
+	Common::Array<Common::String> *mainMethodSlots = _methodSlots;
+	_methodSlots = new Common::Array<Common::String>;
 
+	Common::Array<Common::String> *argNames = new Common::Array<Common::String>;
 	if (_inFactory) {
-		registerMethodVar("me", kVarArgument);
+		argNames->push_back("me");
 	}
 	for (uint i = 0; i < node->args->size(); i++) {
-		registerMethodVar(*(*node->args)[i], kVarArgument);
+		argNames->push_back(Common::String((*node->args)[i]->c_str()));
+	}
+	for (auto &name : *argNames) {
+		registerMethodVar(name, kVarArgument);
 	}
+	// Arguments take the first slots, local variables are added as they are registered
+	_methodSlots->push_back(*argNames);
 	for (auto &i : *mainMethodVars) {
 		if (i._value == kVarGlobal)
 			registerMethodVar(i._key, kVarGlobal);
@@ -501,17 +534,9 @@ bool LingoCompiler::visitHandlerNode(HandlerNode *node) {
 	if (debugChannelSet(1, kDebugCompile))
 		debug("define handler \"%s\" (len: %d)", node->name->c_str(), _currentAssembly->size() - 1);
 
-	Common::Array<Common::String> *argNames = new Common::Array<Common::String>;
-	if (_inFactory) {
-		argNames->push_back("me");
-	}
-	for (uint i = 0; i < node->args->size(); i++) {
-		argNames->push_back(Common::String((*node->args)[i]->c_str()));
-	}
 	Common::Array<Common::String> *varNames = new Common::Array<Common::String>;
-	for (auto &it : *_methodVars) {
-		if (it._value == kVarLocal)
-			varNames->push_back(Common::String(it._key));
+	for (uint i = argNames->size(); i < _methodSlots->size(); i++) {
+		varNames->push_back((*_methodSlots)[i]);
 	}
 
 	if (debugChannelSet(1, kDebugCompile)) {
@@ -534,6 +559,8 @@ bool LingoCompiler::visitHandlerNode(HandlerNode *node) {
 	_currentAssembly = mainAssembly;
 	delete _methodVars;
 	_methodVars = mainMethodVars;
+	delete _methodSlots;
+	_methodSlots = mainMethodSlots;
 	return true;
 }
 
@@ -48,6 +48,7 @@ public:
 	void codeVarSet(const Common::String &name);
 	void codeVarRef(const Common::String &name);
 	void codeVarGet(const Common::String &name);
+	int getMethodVarSlot(const Common::String &name);
 	int getTheFieldID(int entity, const Common::String &field, bool silent = false);
 	void registerFactory(Common::String &s);
 	void registerMethodVar(const Common::String &name, VarType type = kVarGeneric);
@@ -68,6 +69,8 @@ public:
 	bool _refMode;
 
 	Common::HashMap<Common::String, VarType, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> *_methodVars;
+	// Arguments followed by local variables of the handler being compiled, in slot order
+	Common::Array<Common::String> *_methodSlots;
 
 	bool _hadError;
 
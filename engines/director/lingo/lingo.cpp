@@ -20,6 +20,7 @@
  */
 
 #include "common/file.h"
+#include "common/profiler.h"
 
 #include "graphics/macgui/macwindowmanager.h"
 
@@ -617,6 +618,7 @@ Common::String Lingo::formatFunctionBody(Symbol &sym) {
 }
 
 bool Lingo::execute(int targetFrame) {
+	PROFILE_SCOPE("Lingo::execute");
 	uint localCounter = 0;
 
 	while (!_abort && !_freezeState && !_playDone && _state->script && (*_state->script)[_state->pc] != STOP) {
@@ -1694,13 +1696,32 @@ int Lingo::getInt(uint pc) {
 	return (int)READ_UINT32(&((*_state->script)[pc]));
 }
 
+Datum *Lingo::findLocalVar(const Common::String &name) {
+	if (!_state->localVars)
+		return nullptr;
+
+	// Look the variable up once, instead of contains() followed by operator[]
+	DatumHash::iterator it = _state->localVars->find(name);
+	return it != _state->localVars->end() ? &it->_value : nullptr;
+}
+
+Datum *Lingo::findLocalSlot(int slot) {
+	// Slots are resolved by the compilers, see CFrame::localSlots
+	if (_state->callstack.empty() || slot < 0)
+		return nullptr;
+
+	Common::Array<Datum *> &slots = _state->callstack.back()->localSlots;
+	return slot < (int)slots.size() ? slots[slot] : nullptr;
+}
+
 void Lingo::varAssign(const Datum &var, const Datum &value) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
+			const Common::String &name = *var.u.s;
+			Datum *local = findLocalVar(name);
+			if (local) {
+				*local = value;
 				g_debugger->varWriteHook(name);
 				return;
 			}
@@ -1722,9 +1743,10 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
+			const Common::String &name = *var.u.s;
+			Datum *local = findLocalVar(name);
+			if (local) {
+				*local = value;
 				g_debugger->varWriteHook(name);
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
@@ -1733,7 +1755,7 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
 				g_debugger->varWriteHook(name);
@@ -1814,18 +1836,19 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
 
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			const Datum *local = findLocalVar(name);
+			if (local) {
+				return *local;
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator global = _globalvars.find(name);
+			if (global != _globalvars.end()) {
+				return global->_value;
 			}
 
 			if (!silent)
@@ -1835,10 +1858,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator global = _globalvars.find(name);
+			if (global != _globalvars.end()) {
+				return global->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1846,10 +1870,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			const Datum *local = findLocalVar(name);
+			if (local) {
+				return *local;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1857,7 +1882,7 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
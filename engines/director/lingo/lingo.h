@@ -260,6 +260,7 @@ struct CFrame {	/* proc/func call stack frame */
 	Datum			defaultRetVal;		/* default return value */
 	int				paramCount;			/* original number of arguments submitted */
 	Common::Array<Datum> paramList;		/* original argument list */
+	Common::Array<Datum *> localSlots;	/* local variables of sp.argNames followed by sp.varNames */
 };
 
 struct LingoEvent {
@@ -415,6 +416,8 @@ public:
 	void pushContext(const Symbol funcSym, bool allowRetVal, Datum defaultRetVal, int paramCount, int nargs);
 	void popContext(bool aborting = false);
 	void cleanLocalVars();
+	Datum *findLocalVar(const Common::String &name);
+	Datum *findLocalSlot(int slot);
 	void varAssign(const Datum &var, const Datum &value);
 	Datum varFetch(const Datum &var, bool silent = false);
 	Common::U32String evalChunkRef(const Datum &var);
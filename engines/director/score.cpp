@@ -1571,8 +1571,35 @@ Common::List<Channel *> Score::getSpriteIntersections(const Common::Rect &r) {
 	Common::List<Channel *> intersections;
 	Common::List<Channel *> appendix;
 
-	for (uint i = 0; i < _channels.size(); i++) {
-		if (!_channels[i]->isEmpty() && !r.findIntersectingRect(_channels[i]->getBbox()).isEmpty()) {
+	Common::Array<uint16> candidates;
+	if (_spriteGridValid) {
+		// Only look at the channels registered in the grid cells the rect covers
+		int x1, y1, x2, y2;
+		getSpriteGridCells(r, x1, y1, x2, y2);
+		_spriteGridMark++;
+		for (int y = y1; y <= y2; y++) {
+			for (int x = x1; x <= x2; x++) {
+				for (auto &i : _spriteGridCells[y * _spriteGridCols + x]) {
+					if (_spriteGridMarks[i] != _spriteGridMark) {
+						_spriteGridMarks[i] = _spriteGridMark;
+						candidates.push_back(i);
+					}
+				}
+			}
+		}
+		// Keep the channel order
+		if (x1 != x2 || y1 != y2)
+			Common::sort(candidates.begin(), candidates.end());
+	} else {
+		for (uint i = 0; i < _channels.size(); i++) {
+			if (!_channels[i]->isEmpty())
+				candidates.push_back(i);
+		}
+	}
+
+	for (auto &i : candidates) {
+		Common::Rect bbox = _spriteGridValid ? _spriteGridBboxes[i] : _channels[i]->getBbox();
+		if (!r.findIntersectingRect(bbox).isEmpty()) {
 			// Editable text sprites will (more or less) always be rendered in front of other sprites,
 			// regardless of their order in the channel list.
 			if (_channels[i]->getEditable()) {
@@ -1589,6 +1616,51 @@ Common::List<Channel *> Score::getSpriteIntersections(const Common::Rect &r) {
 	return intersections;
 }
 
+void Score::getSpriteGridCells(const Common::Rect &r, int &x1, int &y1, int &x2, int &y2) {
+	// Anything outside of the grid bounds belongs to the border cells
+	x1 = CLIP<int>((r.left - _spriteGridBounds.left) / SCORE_SPRITE_GRID_CELL, 0, _spriteGridCols - 1);
+	y1 = CLIP<int>((r.top - _spriteGridBounds.top) / SCORE_SPRITE_GRID_CELL, 0, _spriteGridRows - 1);
+	x2 = CLIP<int>((r.right - 1 - _spriteGridBounds.left) / SCORE_SPRITE_GRID_CELL, 0, _spriteGridCols - 1);
+	y2 = CLIP<int>((r.bottom - 1 - _spriteGridBounds.top) / SCORE_SPRITE_GRID_CELL, 0, _spriteGridRows - 1);
+}
+
+void Score::buildSpriteGrid(const Common::Rect &bounds) {
+	_spriteGridBounds = bounds;
+	_spriteGridCols = MAX<int>(1, (bounds.width() + SCORE_SPRITE_GRID_CELL - 1) / SCORE_SPRITE_GRID_CELL);
+	_spriteGridRows = MAX<int>(1, (bounds.height() + SCORE_SPRITE_GRID_CELL - 1) / SCORE_SPRITE_GRID_CELL);
+
+	_spriteGridCells.resize(_spriteGridCols * _spriteGridRows);
+	for (auto &cell : _spriteGridCells)
+		cell.clear();
+	_spriteGridBboxes.resize(_channels.size());
+	_spriteGridMarks.resize(_channels.size());
+	for (auto &mark : _spriteGridMarks)
+		mark = 0;
+	_spriteGridMark = 0;
+
+	for (uint i = 0; i < _channels.size(); i++) {
+		if (_channels[i]->isEmpty())
+			continue;
+
+		Common::Rect bbox = _channels[i]->getBbox();
+		_spriteGridBboxes[i] = bbox;
+		if (bbox.isEmpty())
+			continue;
+
+		int x1, y1, x2, y2;
+		getSpriteGridCells(bbox, x1, y1, x2, y2);
+		for (int y = y1; y <= y2; y++)
+			for (int x = x1; x <= x2; x++)
+				_spriteGridCells[y * _spriteGridCols + x].push_back(i);
+	}
+
+	_spriteGridValid = true;
+}
+
+void Score::clearSpriteGrid() {
+	_spriteGridValid = false;
+}
+
 uint16 Score::getSpriteIdByMemberId(CastMemberID id) {
 	for (uint i = 0; i < _channels.size(); i++)
 		if (_channels[i]->_sprite->_castId == id)
@@ -1769,7 +1841,12 @@ void Score::loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version)
 	// Calculate number of frames and their positions
 	// numOfFrames in the header is often incorrect
 	for (_numFrames = 1; loadFrame(_numFrames, false); _numFrames++) {
-		_scoreCache.push_back(new Frame(*_currentFrame));
+		Frame *frame = new Frame(*_currentFrame);
+		// Frame copy constructor skips some of the main channels, which are
+		// needed when seeking backwards from the cached frames
+		frame->_mainChannels = _currentFrame->_mainChannels;
+		_scoreCache.push_back(frame);
+		_scoreCachePositions.push_back(_framesStream->pos());
 	}
 
 	debugC(1, kDebugLoading, "Score::loadFrames(): Calculated, total number of frames %d!", _numFrames);
@@ -1788,17 +1865,41 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	int targetFrame = frameNum;
 
 	if (frameNum <= (int)_curFrameNumber) {
-		debugC(7, kDebugLoading, "****** Resetting frame %d to start %" PRId64, sourceFrame, _framesStream->pos());
-		// If we are going back, we need to rebuild frames from start
+		// If we are going back, we need to rebuild frames from the cached
+		// frame before the target, or from start if there is none
+		const int cacheIndex = targetFrame - 2;
 		_currentFrame->reset();
-		sourceFrame = 0;
 
-		// Reset position to start
-		_framesStream->seek(_firstFramePosition);
+		if (cacheIndex >= 0 && cacheIndex < (int)_scoreCache.size() && cacheIndex < (int)_scoreCachePositions.size()) {
+			const Frame *cached = _scoreCache[cacheIndex];
+			debugC(7, kDebugLoading, "****** Resetting frame %d to cached frame %d", sourceFrame, cacheIndex + 1);
+			sourceFrame = cacheIndex + 1;
+			_framesStream->seek(_scoreCachePositions[cacheIndex]);
+
+			// Restore the score channels as they were after the cached frame.
+			// Like Sprite::reset(), leave the puppet state set by Lingo alone.
+			_currentFrame->_mainChannels = cached->_mainChannels;
+			for (uint i = 0; i < _currentFrame->_sprites.size() && i < cached->_sprites.size(); i++) {
+				Sprite *sprite = _currentFrame->_sprites[i];
+				const bool puppet = sprite->_puppet;
+				const uint32 autoPuppet = sprite->_autoPuppet;
+
+				*sprite = *cached->_sprites[i];
+				sprite->_frame = _currentFrame;
+				sprite->_puppet = puppet;
+				sprite->_autoPuppet = autoPuppet;
+			}
+		} else {
+			debugC(7, kDebugLoading, "****** Resetting frame %d to start %" PRId64, sourceFrame, _framesStream->pos());
+			sourceFrame = 0;
+
+			// Reset position to start
+			_framesStream->seek(_firstFramePosition);
 
-		// Reset sprite contents
-		for (auto &it : _currentFrame->_sprites)
-			it->reset();
+			// Reset sprite contents
+			for (auto &it : _currentFrame->_sprites)
+				it->reset();
+		}
 	}
 
 	debugC(7, kDebugLoading, "****** Source frame %d to Destination frame %d, current offset %" PRId64, sourceFrame, targetFrame, _framesStream->pos());
@@ -53,6 +53,9 @@ class Sprite;
 class CastMember;
 class AudioDecoder;
 
+// Size of the sprite grid cell, in pixels
+#define SCORE_SPRITE_GRID_CELL 64
+
 struct Label {
 	Common::String comment;
 	Common::String name;
@@ -115,6 +118,8 @@ public:
 	bool checkSpriteRollOver(uint16 spriteId, Common::Point pos);
 	uint16 getRollOverSpriteIDFromPos(Common::Point pos);
 	Common::List<Channel *> getSpriteIntersections(const Common::Rect &r);
+	void buildSpriteGrid(const Common::Rect &bounds);
+	void clearSpriteGrid();
 	uint16 getSpriteIdByMemberId(CastMemberID id);
 	bool refreshPointersForCastMemberID(CastMemberID id);
 	bool refreshPointersForCastLib(uint16 castLib);
@@ -150,6 +155,8 @@ private:
 	bool processImmediateFrameScript(Common::String s, int id);
 	bool processFrozenScripts(bool recursion = false, int count = 0);
 
+	void getSpriteGridCells(const Common::Rect &r, int &x1, int &y1, int &x2, int &y2);
+
 public:
 	Common::Array<Channel *> _channels;
 	Common::SortedArray<Label *> *_labels;
@@ -157,6 +164,7 @@ public:
 	Common::HashMap<uint16, bool> _immediateActions;
 
 	Common::Array<Frame *> _scoreCache;
+	Common::Array<uint> _scoreCachePositions;	// stream position after each frame in _scoreCache
 
 	// On demand frames loading
 	uint32 _version;
@@ -208,6 +216,16 @@ private:
 	DirectorSound *_soundManager;
 
 	int _previousBuildBotBuild = -1;
+
+	// Spatial index of the channel bounding boxes, valid during a single render
+	bool _spriteGridValid = false;
+	Common::Rect _spriteGridBounds;
+	int _spriteGridCols = 0;
+	int _spriteGridRows = 0;
+	Common::Array<Common::Array<uint16> > _spriteGridCells;
+	Common::Array<Common::Rect> _spriteGridBboxes;
+	Common::Array<uint32> _spriteGridMarks;
+	uint32 _spriteGridMark = 0;
 };
 
 } // End of namespace Director
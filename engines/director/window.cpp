@@ -21,6 +21,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/macresman.h"
 
@@ -153,6 +154,8 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	if (!_currentMovie)
 		return false;
 
+	PROFILE_SCOPE("Window::render");
+
 	if (!blitTo)
 		blitTo = _composeSurface;
 
@@ -178,6 +181,11 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	uint32 renderStartTime = g_system->getMillis();
 	debugC(7, kDebugImages, "Window::render(): Updating %d rects", _dirtyRects.size());
 
+	// Channels don't change while rendering, so index their bounding boxes once
+	// instead of testing every channel against every dirty rect
+	Score *score = _currentMovie->getScore();
+	score->buildSpriteGrid(Common::Rect(blitTo->w, blitTo->h));
+
 	for (auto &i : _dirtyRects) {
 		Common::Rect r = i;
 		// The inner dimensions are relative to the virtual desktop while
@@ -187,7 +195,7 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 		windowRect.moveTo(r.left, r.top);
 		r.clip(windowRect);
 
-		_dirtyChannels = _currentMovie->getScore()->getSpriteIntersections(r);
+		_dirtyChannels = score->getSpriteIntersections(r);
 
 		bool shouldClear = true;
 		Channel *trailChannel = nullptr;
@@ -233,6 +241,8 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 		}
 	}
 
+	score->clearSpriteGrid();
+
 #ifdef USE_IMGUI
 	int selectedChannel = DT::getSelectedChannel();
 	if (selectedChannel > 0)
@@ -327,6 +337,7 @@ void Window::reset() {
 }
 
 void Window::inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::ManagedSurface *blitTo) {
+	PROFILE_SCOPE("Window::inkBlitFrom");
 	Common::Rect srcRect = channel->getBbox();
 	destRect.clip(srcRect);
 
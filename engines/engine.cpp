@@ -23,6 +23,7 @@
 #include "engines/dialogs.h"
 #include "engines/util.h"
 #include "engines/metaengine.h"
+#include "engines/saveindex.h"
 
 #include "common/config-manager.h"
 #include "common/events.h"
@@ -33,6 +34,8 @@
 #include "common/error.h"
 #include "common/list.h"
 #include "common/memstream.h"
+#include "common/profiler.h"
+#include "common/rewindbuffer.h"
 #include "common/savefile.h"
 #include "common/scummsys.h"
 #include "common/taskbar.h"
@@ -152,7 +155,11 @@ Engine::Engine(OSystem *syst)
 		_mainMenuDialog(NULL),
 		_debugger(NULL),
 		_autosaveInterval(ConfMan.getInt("autosave_period")),
-		_lastAutosaveTime(_system->getMillis()) {
+		_lastAutosaveTime(_system->getMillis()),
+		_rewindInterval(ConfMan.getInt("rewind_period")),
+		_lastRewindTime(_system->getMillis()),
+		_rewindStartTime(0),
+		_rewindBuffer(nullptr) {
 
 	g_engine = this;
 	_quitRequested = false;
@@ -217,6 +224,7 @@ Engine::~Engine() {
 
 	delete _debugger;
 	delete _mainMenuDialog;
+	delete _rewindBuffer;
 	g_engine = NULL;
 
 	// Remove our cursors again to prevent memory leaks
@@ -706,6 +714,73 @@ void Engine::saveAutosaveIfEnabled() {
 	_autoSaving = false;
 }
 
+void Engine::handleRewindSnapshot() {
+	if (_rewindInterval <= 0 || _autoSaving || isPaused())
+		return;
+
+	const uint32 now = _system->getMillis();
+	if (now - _lastRewindTime < (uint32)_rewindInterval * 1000)
+		return;
+
+	// Updated first, saving the game may poll events and get back here
+	_lastRewindTime = now;
+	if (!canSaveAutosaveCurrently())
+		return;
+
+	PROFILE_SCOPE("Engine::handleRewindSnapshot");
+
+	Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+	if (saveGameStream(&stream, false).getCode() != Common::kNoError) {
+		warning("Engine: Could not take a rewind snapshot, rewinding is disabled");
+		_rewindInterval = 0;
+		return;
+	}
+
+	if (!_rewindBuffer) {
+		const uint64 budget = (uint64)MAX(ConfMan.getInt("rewind_memory"), 1) * 1024 * 1024;
+		_rewindBuffer = new Common::RewindBuffer((uint32)MIN<uint64>(budget, 0xFFFFFFFF));
+		_rewindStartTime = now;
+	}
+	_rewindBuffer->push(stream.getData(), stream.size());
+
+	if (Common::Profiler::isActive()) {
+		ProfMan.setCounter("Rewind memory", _rewindBuffer->getMemoryUsage());
+
+		// Only counts the memory of the new blocks, the shared ones are free
+		const uint32 elapsed = now - _rewindStartTime;
+		if (elapsed > 0)
+			ProfMan.setCounter("Rewind bytes per minute", (int32)(_rewindBuffer->getAllocatedBytes() * 60000 / elapsed));
+	}
+}
+
+bool Engine::rewindGameState() {
+	if (!_rewindBuffer || _rewindBuffer->empty()) {
+		g_system->displayMessageOnOSD(_("Nothing to rewind"));
+		return false;
+	}
+
+	if (!canLoadGameStateCurrently()) {
+		g_system->displayMessageOnOSD(_("Rewinding is currently unavailable"));
+		return false;
+	}
+
+	Common::Array<byte> data;
+	if (!_rewindBuffer->pop(data)) {
+		g_system->displayMessageOnOSD(_("Error occurred while rewinding"));
+		return false;
+	}
+
+	Common::MemoryReadStream stream(data.data(), data.size());
+	if (loadGameStream(&stream).getCode() != Common::kNoError) {
+		g_system->displayMessageOnOSD(_("Error occurred while rewinding"));
+		return false;
+	}
+
+	// Take the next snapshot a whole interval after the restored one
+	_lastRewindTime = _system->getMillis();
+	return true;
+}
+
 void Engine::errorString(const char *buf1, char *buf2, int size) {
 	Common::strlcpy(buf2, buf1, size);
 }
@@ -952,6 +1027,9 @@ Common::Error Engine::saveGameState(int slot, const Common::String &desc, bool i
 	}
 
 	delete saveFile;
+
+	// The meta infos of the save in the save index are out of date
+	SaveStateIndex::invalidate(_targetName, getSaveStateName(slot));
 	return result;
 }
 
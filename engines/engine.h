@@ -43,6 +43,7 @@ class EventManager;
 class SaveFileManager;
 class TimerManager;
 class FSNode;
+class RewindBuffer;
 class SeekableReadStream;
 class WriteStream;
 }
@@ -224,6 +225,26 @@ private:
 	 */
 	int _lastAutosaveTime;
 
+	/**
+	 * Rewind snapshot interval, in seconds. 0 if rewinding is disabled.
+	 */
+	int _rewindInterval;
+
+	/**
+	 * The last time a rewind snapshot was taken.
+	 */
+	uint32 _lastRewindTime;
+
+	/**
+	 * The time when the first rewind snapshot was taken.
+	 */
+	uint32 _rewindStartTime;
+
+	/**
+	 * Rewind snapshots of the game state, created with the first one.
+	 */
+	Common::RewindBuffer *_rewindBuffer;
+
 	/**
 	 * Save slot selected via the global main menu.
 	 *
@@ -654,6 +675,22 @@ public:
 	 */
 	void saveAutosaveIfEnabled();
 
+	/**
+	 * Check whether it is time to take a rewind snapshot, and if so, take it.
+	 *
+	 * The snapshots are made with saveGameStream(), every "rewind_period"
+	 * seconds, and kept within "rewind_memory" megabytes.
+	 */
+	void handleRewindSnapshot();
+
+	/**
+	 * Restore the game state of the last rewind snapshot, and drop it,
+	 * so that the next call steps further back.
+	 *
+	 * @return true if the game state was restored.
+	 */
+	bool rewindGameState();
+
 	/**
 	 * Indicate whether an autosave can currently be done.
 	 */
@@ -21,6 +21,7 @@
 
 #include "engines/metaengine.h"
 #include "engines/engine.h"
+#include "engines/saveindex.h"
 
 #include "backends/keymapper/action.h"
 #include "backends/keymapper/keymap.h"
@@ -413,16 +414,88 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 
 SaveStateList MetaEngine::listSaves(const char *target, bool saveMode) const {
 	SaveStateList saveList = listSaves(target);
+	addDummyAutosave(saveList, saveMode);
+	return saveList;
+}
+
+SaveStateList MetaEngine::listIndexedSaves(const char *target, bool saveMode, SaveStateIndex &index, bool &indexed) const {
+	indexed = false;
+	if (!hasFeature(kSavesSupportMetaInfo))
+		return listSaves(target, saveMode);
+
+	// Look for changes in the save files, only the ones which changed are read
+	const bool loaded = index.load();
+	const SaveStateIndex::FileInfoMap files = index.listFiles(getSavegameFilePattern(target));
+
+	if (loaded && index.isUpToDate(files)) {
+		index.save();
+		SaveStateList saveList = index.getSaveStates();
+		addDummyAutosave(saveList, saveMode);
+		indexed = true;
+		return saveList;
+	}
+
+	SaveStateList saveList = listSaves(target);
+
+	// The saves can only be indexed if they are stored where the save file
+	// pattern says
+	for (const auto &save : saveList) {
+		if (!files.contains(getSavegameFile(save.getSaveSlot(), target))) {
+			index.clear();
+			index.save();
+			addDummyAutosave(saveList, saveMode);
+			return saveList;
+		}
+	}
+
+	// Keep the meta infos of the saves which did not change. The others are
+	// only queried when they are shown, see queryIndexedSaveMetaInfos().
+	index.removeStaleEntries(files);
+	for (auto &save : saveList) {
+		const Common::String file = getSavegameFile(save.getSaveSlot(), target);
+		const SaveStateDescriptor *indexedSave = index.findMetaInfos(file);
+		if (indexedSave)
+			save = *indexedSave;
+		else
+			index.add(file, files.getVal(file), &save, false);
+	}
+
+	// Record the other files matching the pattern as well, so that they do
+	// not make the index stale
+	for (SaveStateIndex::FileInfoMap::const_iterator i = files.begin(); i != files.end(); ++i) {
+		if (!index.contains(i->_key))
+			index.add(i->_key, i->_value, nullptr, false);
+	}
+	index.save();
+
+	addDummyAutosave(saveList, saveMode);
+	indexed = true;
+	return saveList;
+}
+
+SaveStateDescriptor MetaEngine::queryIndexedSaveMetaInfos(const char *target, int slot, SaveStateIndex &index) const {
+	const Common::String file = getSavegameFile(slot, target);
+	const SaveStateDescriptor *indexedSave = index.findMetaInfos(file);
+	if (indexedSave)
+		return *indexedSave;
+
+	SaveStateDescriptor desc = querySaveMetaInfos(target, slot);
+	if (desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
+		index.setMetaInfos(file, desc);
+	return desc;
+}
+
+void MetaEngine::addDummyAutosave(SaveStateList &saveList, bool saveMode) const {
 	int autosaveSlot = getAutosaveSlot();
 	if (!saveMode || autosaveSlot == -1)
-		return saveList;
+		return;
 
 	// Check to see if an autosave is present
 	for (auto &save : saveList) {
 		int slot = save.getSaveSlot();
 		if (slot == autosaveSlot) {
 			// It has an autosave
-			return saveList;
+			return;
 		}
 	}
 
@@ -435,8 +508,6 @@ SaveStateList MetaEngine::listSaves(const char *target, bool saveMode) const {
 
 	saveList.push_back(desc);
 	Common::sort(saveList.begin(), saveList.end(), SaveStateDescriptorSlotComparator());
-
-	return saveList;
 }
 
 void MetaEngine::registerDefaultSettings(const Common::String &) const {
@@ -35,6 +35,7 @@
 
 class Engine;
 class OSystem;
+class SaveStateIndex;
 
 namespace Common {
 class Keymap;
@@ -216,6 +217,12 @@ protected:
 	 */
 	int findEmptySaveSlot(const char *target);
 
+	/**
+	 * Add a write protected entry for the autosave slot to a list for a save
+	 * dialog, if there is no autosave yet.
+	 */
+	void addDummyAutosave(SaveStateList &saveList, bool saveMode) const;
+
 	/**
 	 * Return a list of extra GUI options for the specified target.
 	 *
@@ -314,6 +321,33 @@ public:
 	 */
 	SaveStateList listSaves(const char *target, bool saveMode) const;
 
+	/**
+	 * Return a list of all save states associated with the given target,
+	 * from the save index of the target when possible.
+	 *
+	 * The index, see SaveStateIndex, holds the save states of the target, and
+	 * the meta infos of the ones which were shown. It is used as long as the
+	 * save files did not change, otherwise the save states are listed again
+	 * and the meta infos of the changed ones are dropped.
+	 *
+	 * @param target    Name of a config manager target.
+	 * @param saveMode  If true, get the list for a save dialog.
+	 * @param index     The index of the target, loaded and updated by this call.
+	 * @param indexed   Set to true if the index can be used with
+	 *                  queryIndexedSaveMetaInfos(), false if the saves of the
+	 *                  target cannot be indexed.
+	 * @return A list of save state descriptors.
+	 */
+	SaveStateList listIndexedSaves(const char *target, bool saveMode, SaveStateIndex &index, bool &indexed) const;
+
+	/**
+	 * Return the meta infos of a save state from the save index, or query
+	 * them with querySaveMetaInfos() and add them to the index.
+	 *
+	 * The index has to be saved afterwards, see SaveStateIndex::save().
+	 */
+	SaveStateDescriptor queryIndexedSaveMetaInfos(const char *target, int slot, SaveStateIndex &index) const;
+
 	/**
 	 * Return the slot number that is used for autosaves, or -1 for engines that
 	 * don't support autosave.
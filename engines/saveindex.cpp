@@ -0,0 +1,328 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "engines/saveindex.h"
+
+#include "common/algorithm.h"
+#include "common/config-manager.h"
+#include "common/crc.h"
+#include "common/endian.h"
+#include "common/file.h"
+#include "common/ptr.h"
+#include "common/savefile.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "graphics/surface.h"
+#include "graphics/thumbnail.h"
+
+// Increase when the format of the entries changes
+static const uint32 kSaveIndexVersion = 3;
+
+// Bytes hashed at the start and at the end of the save files, and at the
+// extended save header
+static const uint32 kChecksumSize = 256;
+
+enum {
+	kEntrySaveState       = 1 << 0,
+	kEntryDeletable       = 1 << 1,
+	kEntryWriteProtected  = 1 << 2,
+	kEntryAutosave        = 1 << 3,
+	kEntryPlayTime        = 1 << 4,
+	kEntryThumbnail       = 1 << 5,
+	kEntryMetaInfos       = 1 << 6
+};
+
+SaveStateIndex::SaveStateIndex(const Common::String &target) : _dirty(false) {
+	const Common::Path iconsPath = ConfMan.getPath("iconspath");
+	if (!iconsPath.empty()) {
+		const Common::String fileName = Common::String::format("%s.idx", target.c_str());
+		_path = iconsPath.join("saveindex").join(fileName);
+	}
+}
+
+SaveStateIndex::FileInfoMap SaveStateIndex::listFiles(const Common::String &pattern) {
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	const Common::StringArray fileNames = saveFileMan->listSavefiles(pattern);
+	const Common::CRC32 crc;
+
+	FileInfoMap files;
+	for (const auto &fileName : fileNames) {
+		FileInfo &info = files[fileName];
+
+		EntryMap::iterator entry = _entries.find(fileName);
+		if (saveFileMan->getSavefileInfo(fileName, info.size, info.timestamp) && entry != _entries.end() &&
+			entry->_value.info.size == info.size && entry->_value.info.timestamp == info.timestamp) {
+			info.checksum = entry->_value.info.checksum;
+			continue;
+		}
+
+		Common::ScopedPtr<Common::InSaveFile> in(saveFileMan->openRawFile(fileName));
+		if (!in)
+			continue;
+
+		info.size = in->size();
+
+		// The save headers are at the start of the files, or at the end for
+		// the extended save format, whose last bytes give the header position.
+		// Compressed save files end with the checksum of their content.
+		byte buffer[3 * kChecksumSize];
+		uint32 count = in->read(buffer, MIN(info.size, kChecksumSize));
+		if (info.size > kChecksumSize) {
+			in->seek(MAX(info.size - kChecksumSize, kChecksumSize));
+			count += in->read(buffer + count, kChecksumSize);
+
+			const uint32 headerPos = READ_LE_UINT32(buffer + count - 4);
+			if (headerPos < info.size - 4) {
+				in->seek(headerPos);
+				count += in->read(buffer + count, kChecksumSize);
+			}
+		}
+
+		info.checksum = crc.crcFast(buffer, count);
+
+		// Files which were touched, but whose headers did not change, are not read again
+		if (entry != _entries.end() && entry->_value.info.size == info.size &&
+			entry->_value.info.checksum == info.checksum && entry->_value.info.timestamp != info.timestamp) {
+			entry->_value.info.timestamp = info.timestamp;
+			_dirty = true;
+		}
+	}
+
+	return files;
+}
+
+bool SaveStateIndex::load() {
+	_entries.clear();
+	_dirty = false;
+
+	if (_path.empty())
+		return false;
+
+	Common::ScopedPtr<Common::File> in(new Common::File());
+	if (!in->open(Common::FSNode(_path)))
+		return false;
+
+	if (in->readUint32BE() != MKTAG('S', 'I', 'D', 'X') || in->readUint32LE() != kSaveIndexVersion)
+		return false;
+
+	const uint32 count = in->readUint32LE();
+	for (uint32 i = 0; i < count && !in->eos() && !in->err(); ++i) {
+		const Common::String fileName = in->readString();
+		Entry entry;
+		entry.info.size = in->readUint32LE();
+		entry.info.timestamp = in->readUint32LE();
+		entry.info.checksum = in->readUint32LE();
+		const byte flags = in->readByte();
+		entry.isSaveState = (flags & kEntrySaveState) != 0;
+		entry.hasMetaInfos = (flags & kEntryMetaInfos) != 0;
+		if (entry.isSaveState) {
+			entry.desc.setSaveSlot(in->readSint32LE());
+			entry.desc.setDescription(in->readString().decode());
+			entry.desc.setDeletableFlag((flags & kEntryDeletable) != 0);
+			entry.desc.setWriteProtectedFlag((flags & kEntryWriteProtected) != 0);
+			entry.desc.setAutosave((flags & kEntryAutosave) != 0);
+
+			int year, month, day, hour, minutes;
+			const Common::String date = in->readString();
+			if (sscanf(date.c_str(), "%d-%d-%d", &year, &month, &day) == 3)
+				entry.desc.setSaveDate(year, month, day);
+			const Common::String time = in->readString();
+			if (sscanf(time.c_str(), "%d:%d", &hour, &minutes) == 2)
+				entry.desc.setSaveTime(hour, minutes);
+
+			const uint32 playTime = in->readUint32LE();
+			if (flags & kEntryPlayTime)
+				entry.desc.setPlayTime(playTime);
+
+			if (flags & kEntryThumbnail) {
+				Graphics::Surface *thumbnail = nullptr;
+				if (!Graphics::loadThumbnail(*in, thumbnail)) {
+					_entries.clear();
+					return false;
+				}
+				entry.desc.setThumbnail(thumbnail);
+			}
+		}
+
+		_entries[fileName] = entry;
+	}
+
+	if (in->err() || in->eos()) {
+		_entries.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void SaveStateIndex::save() {
+	if (!_dirty || _path.empty())
+		return;
+
+	Common::DumpFile out;
+	if (!out.open(_path, true)) {
+		warning("SaveStateIndex: Failed to create '%s'", _path.toString(Common::Path::kNativeSeparator).c_str());
+		return;
+	}
+
+	out.writeUint32BE(MKTAG('S', 'I', 'D', 'X'));
+	out.writeUint32LE(kSaveIndexVersion);
+	out.writeUint32LE(_entries.size());
+
+	for (EntryMap::const_iterator i = _entries.begin(); i != _entries.end(); ++i) {
+		const Entry &entry = i->_value;
+		const SaveStateDescriptor &desc = entry.desc;
+
+		byte flags = 0;
+		if (entry.isSaveState) {
+			flags |= kEntrySaveState;
+			if (entry.hasMetaInfos)
+				flags |= kEntryMetaInfos;
+			if (desc.getDeletableFlag())
+				flags |= kEntryDeletable;
+			if (desc.getWriteProtectedFlag())
+				flags |= kEntryWriteProtected;
+			if (desc.isAutosave())
+				flags |= kEntryAutosave;
+			if (!desc.getPlayTime().empty())
+				flags |= kEntryPlayTime;
+			if (desc.getThumbnail())
+				flags |= kEntryThumbnail;
+		}
+
+		out.writeString(i->_key);
+		out.writeByte(0);
+		out.writeUint32LE(entry.info.size);
+		out.writeUint32LE(entry.info.timestamp);
+		out.writeUint32LE(entry.info.checksum);
+		out.writeByte(flags);
+
+		if (!entry.isSaveState)
+			continue;
+
+		out.writeSint32LE(desc.getSaveSlot());
+		out.writeString(desc.getDescription().encode());
+		out.writeByte(0);
+		out.writeString(desc.getSaveDate());
+		out.writeByte(0);
+		out.writeString(desc.getSaveTime());
+		out.writeByte(0);
+		out.writeUint32LE(desc.getPlayTimeMSecs());
+		if (desc.getThumbnail())
+			Graphics::saveThumbnail(out, *desc.getThumbnail());
+	}
+
+	out.finalize();
+	if (out.err())
+		warning("SaveStateIndex: Failed to write '%s'", _path.toString(Common::Path::kNativeSeparator).c_str());
+	else
+		_dirty = false;
+}
+
+void SaveStateIndex::clear() {
+	if (_entries.empty())
+		return;
+
+	_entries.clear();
+	_dirty = true;
+}
+
+bool SaveStateIndex::isUpToDate(const FileInfoMap &files) const {
+	if (files.size() != _entries.size())
+		return false;
+
+	for (FileInfoMap::const_iterator i = files.begin(); i != files.end(); ++i) {
+		EntryMap::const_iterator entry = _entries.find(i->_key);
+		if (entry == _entries.end() || entry->_value.info.size != i->_value.size ||
+			entry->_value.info.checksum != i->_value.checksum)
+			return false;
+	}
+	return true;
+}
+
+void SaveStateIndex::removeStaleEntries(const FileInfoMap &files) {
+	Common::StringArray stale;
+	for (EntryMap::const_iterator i = _entries.begin(); i != _entries.end(); ++i) {
+		FileInfoMap::const_iterator file = files.find(i->_key);
+		if (file == files.end() || file->_value.size != i->_value.info.size ||
+			file->_value.checksum != i->_value.info.checksum)
+			stale.push_back(i->_key);
+	}
+
+	for (const auto &fileName : stale)
+		remove(fileName);
+}
+
+const SaveStateDescriptor *SaveStateIndex::findMetaInfos(const Common::String &fileName) const {
+	EntryMap::const_iterator entry = _entries.find(fileName);
+	if (entry == _entries.end() || !entry->_value.isSaveState || !entry->_value.hasMetaInfos)
+		return nullptr;
+	return &entry->_value.desc;
+}
+
+void SaveStateIndex::add(const Common::String &fileName, const FileInfo &info, const SaveStateDescriptor *desc, bool hasMetaInfos) {
+	Entry &entry = _entries[fileName];
+	entry.info = info;
+	entry.isSaveState = (desc != nullptr);
+	entry.hasMetaInfos = hasMetaInfos && desc;
+	entry.desc = desc ? *desc : SaveStateDescriptor();
+	_dirty = true;
+}
+
+void SaveStateIndex::setMetaInfos(const Common::String &fileName, const SaveStateDescriptor &desc) {
+	EntryMap::iterator entry = _entries.find(fileName);
+	if (entry == _entries.end())
+		return;
+
+	entry->_value.isSaveState = true;
+	entry->_value.hasMetaInfos = true;
+	entry->_value.desc = desc;
+	_dirty = true;
+}
+
+void SaveStateIndex::remove(const Common::String &fileName) {
+	if (!_entries.contains(fileName))
+		return;
+
+	_entries.erase(fileName);
+	_dirty = true;
+}
+
+SaveStateList SaveStateIndex::getSaveStates() const {
+	SaveStateList saveList;
+	for (EntryMap::const_iterator i = _entries.begin(); i != _entries.end(); ++i) {
+		if (i->_value.isSaveState)
+			saveList.push_back(i->_value.desc);
+	}
+
+	Common::sort(saveList.begin(), saveList.end(), SaveStateDescriptorSlotComparator());
+	return saveList;
+}
+
+void SaveStateIndex::invalidate(const Common::String &target, const Common::String &fileName) {
+	SaveStateIndex index(target);
+	if (!index.load())
+		return;
+
+	index.remove(fileName);
+	index.save();
+}
@@ -0,0 +1,154 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ENGINES_SAVEINDEX_H
+#define ENGINES_SAVEINDEX_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/path.h"
+#include "common/str.h"
+
+#include "engines/savestate.h"
+
+/**
+ * @defgroup engines_saveindex Save state index
+ * @ingroup engines
+ *
+ * @brief Index of the save state meta infos of a target.
+ *
+ * @{
+ */
+
+/**
+ * Index of the save states of a target, with their meta infos.
+ *
+ * It is stored in a single file, so that the save/load chooser can list the
+ * save states without opening and decoding every one of them. The file is
+ * kept in the icons path, with the other caches, rather than with the save
+ * states, which may be synced. Each entry records the size of its save file
+ * and a checksum of its first and last bytes, which hold the save header in
+ * the usual save formats. An entry is only used while its save file matches
+ * both. The save files are only read again when the savefile manager reports
+ * a new size or modification time for them, see
+ * Common::SaveFileManager::getSavefileInfo().
+ *
+ * The meta infos, see MetaEngine::querySaveMetaInfos(), are only added to
+ * the entries of the save states which are actually shown. Until then, an
+ * entry holds the save state as listed by MetaEngine::listSaves().
+ *
+ * Files which are not save states, as far as the engine is concerned, are
+ * recorded as well, so that they do not make the index stale.
+ */
+class SaveStateIndex {
+public:
+	/** Identification of the content of a save file */
+	struct FileInfo {
+		uint32 size;
+		uint32 timestamp;	///< Modification time, 0 if the savefile manager cannot tell
+		uint32 checksum;
+
+		FileInfo() : size(0), timestamp(0), checksum(0) {}
+	};
+
+	/** Save files, by file name */
+	typedef Common::HashMap<Common::String, FileInfo> FileInfoMap;
+
+	SaveStateIndex(const Common::String &target);
+
+	/**
+	 * Get the size and checksum of the save files matching a pattern.
+	 *
+	 * The checksums of the files whose size and modification time did not
+	 * change since they were indexed are taken from the index, the other
+	 * files are read.
+	 */
+	FileInfoMap listFiles(const Common::String &pattern);
+
+	/**
+	 * Read the index file.
+	 *
+	 * @return true if the index could be read.
+	 */
+	bool load();
+
+	/** Write the index file, if it changed since it was loaded or saved. */
+	void save();
+
+	/** Drop all the entries, e.g. when the save states cannot be indexed. */
+	void clear();
+
+	/** Check whether the index covers exactly the given save files. */
+	bool isUpToDate(const FileInfoMap &files) const;
+
+	/** Drop the entries of the files which are not in the list, or changed. */
+	void removeStaleEntries(const FileInfoMap &files);
+
+	/**
+	 * Return the save state stored in a save file, with its meta infos.
+	 *
+	 * @return The save state, or nullptr if its meta infos are not indexed.
+	 */
+	const SaveStateDescriptor *findMetaInfos(const Common::String &fileName) const;
+
+	/** Check whether a save file is in the index. */
+	bool contains(const Common::String &fileName) const { return _entries.contains(fileName); }
+
+	/**
+	 * Add a save file, with the save state it contains if any.
+	 *
+	 * @param hasMetaInfos  Whether the save state comes with its meta infos.
+	 */
+	void add(const Common::String &fileName, const FileInfo &info, const SaveStateDescriptor *desc, bool hasMetaInfos);
+
+	/** Set the meta infos of a save state which is already in the index. */
+	void setMetaInfos(const Common::String &fileName, const SaveStateDescriptor &desc);
+
+	/** Drop the entry of a save file, e.g. when it is overwritten. */
+	void remove(const Common::String &fileName);
+
+	/** Return the indexed save states, sorted by slot. */
+	SaveStateList getSaveStates() const;
+
+	/**
+	 * Drop the entry of a save file from the index file of a target, if
+	 * there is one. To be called when the save file is written.
+	 */
+	static void invalidate(const Common::String &target, const Common::String &fileName);
+
+private:
+	struct Entry {
+		FileInfo info;
+		bool isSaveState;
+		bool hasMetaInfos;
+		SaveStateDescriptor desc;
+	};
+
+	typedef Common::HashMap<Common::String, Entry> EntryMap;
+
+	Common::Path _path;	///< Empty if there is no icons path
+	EntryMap _entries;
+	bool _dirty;
+};
+
+/** @} */
+
+#endif
@@ -39,6 +39,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -87,6 +89,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("cosdump",   WRAP_METHOD(ScummDebugger, Cmd_Cosdump));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resources", WRAP_METHOD(ScummDebugger, Cmd_Resources));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -1064,6 +1067,51 @@ bool ScummDebugger::Cmd_Debug(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		res->resetResourceStats();
+		debugPrintf("Resource counters reset.\n");
+		return true;
+	}
+
+	if (argc == 4 && !strcmp(argv[1], "budget")) {
+		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+			if (!scumm_stricmp(argv[2], nameOfResType(type))) {
+				res->setTypeBudget(type, atoi(argv[3]) * 1024);
+				debugPrintf("Budget for %s set to %d KB.\n", nameOfResType(type), atoi(argv[3]));
+				return true;
+			}
+		}
+		debugPrintf("Unknown resource type '%s'\n", argv[2]);
+		return true;
+	}
+
+	if (argc != 1) {
+		debugPrintf("Syntax: resources [reset | budget <type> <KB>]\n");
+		debugPrintf("Without parameters, prints memory use and cache counters per resource type.\n");
+		debugPrintf("A budget of 0 removes the limit for the given type.\n");
+		return true;
+	}
+
+	debugPrintf("Heap: %d KB\n", res->getHeapSize() / 1024);
+	debugPrintf("%-12s %8s %8s %8s %8s %8s %8s %8s %8s\n", "Type", "KB", "Budget", "Hits", "Misses", "Reloads", "ReldKB", "Evicts", "EvctKB");
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::ResTypeData &data = res->_types[type];
+		if (data.empty())
+			continue;
+
+		debugPrintf("%-12s %8d %8d %8d %8d %8d %8d %8d %8d\n", nameOfResType(type),
+			data._allocatedSize / 1024, data._budget / 1024,
+			data._stats.hits, data._stats.misses,
+			data._stats.reloads, data._stats.bytesReloaded / 1024,
+			data._stats.evictions, data._stats.bytesEvicted / 1024);
+	}
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_Camera(int argc, const char **argv) {
 	debugPrintf("Camera: cur (%d,%d) - dest (%d,%d) - accel (%d,%d) -- last (%d,%d)\n",
 		_vm->camera._cur.x, _vm->camera._cur.y, _vm->camera._dest.x, _vm->camera._dest.y,
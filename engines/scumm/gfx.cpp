@@ -215,7 +215,11 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_vertStripNextInc = 0;
 	_zbufferDisabled = false;
 	_objectMode = false;
+	_roomBackgroundMode = false;
 	_distaff = false;
+
+	for (int i = 0; i < 256; i++)
+		_identityPalette[i] = i;
 }
 
 Gdi::~Gdi() {
@@ -282,9 +286,12 @@ void Gdi::init() {
 		// the backbuf (thus we have to treat the right border separately).
 		_numStrips += 1;
 	}
+
+	flushStripCache();
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	flushStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1178,7 +1185,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbRoomBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -2361,6 +2368,7 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_vertStripNextInc = height * vs->pitch - 1 * vs->format.bytesPerPixel;
 
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
+	_roomBackgroundMode = (flag & dbRoomBackground) != 0;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
 	sx = x - vs->xstart / 8;
@@ -2520,13 +2528,13 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_vm->enhancementEnabled(kEnhVisualChanges)) {
 		_roomPalette[1] = 15;
 
-		byte result = decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+		byte result = decompressCachedBitmap(dstPtr, vs->pitch, stripnr, smap_ptr + offset, height);
 
 		_roomPalette[1] = 1;
 		return result;
 	}
 
-	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	return decompressCachedBitmap(dstPtr, vs->pitch, stripnr, smap_ptr + offset, height);
 }
 
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
@@ -3112,6 +3120,80 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	return transpStrip;
 }
 
+bool Gdi::isStripCacheable(const byte *src) const {
+	// Only 8-bit codecs which emit every pixel through writeRoomColor() and
+	// report their transparency can be replayed from their raw color indices.
+	// The Amiga palette offset is added before the palette lookup, so these
+	// versions are left out as well.
+	if (!_roomBackgroundMode || _vm->_bytesPerPixel != 1 || (_vm->_game.features & GF_16COLOR))
+		return false;
+
+	if (_vm->_game.platform == Common::kPlatformAmiga && _vm->_game.version >= 4)
+		return false;
+
+	switch (*src) {
+	case BMCOMP_RAW256:
+		return !(_vm->_game.features & GF_OLD256);
+
+	case BMCOMP_TOWNS_2:
+	case BMCOMP_TOWNS_3:
+	case BMCOMP_TOWNS_4:
+	case BMCOMP_TOWNS_7:
+	case BMCOMP_TRLE8BIT:
+	case BMCOMP_RLE8BIT:
+	case BMCOMP_PIX32:
+	case BMCOMP_TPIX256:
+		return false;
+
+	default:
+		return true;
+	}
+}
+
+void Gdi::flushStripCache() {
+	_stripCache.clear();
+}
+
+bool Gdi::decompressCachedBitmap(byte *dst, int dstPitch, int stripnr, const byte *src, int numLinesToProcess) {
+	if (!isStripCacheable(src))
+		return decompressBitmap(dst, dstPitch, src, numLinesToProcess);
+
+	if ((uint)stripnr >= _stripCache.size())
+		_stripCache.resize(stripnr + 1);
+
+	CachedStrip &strip = _stripCache[stripnr];
+	if (strip.src != src || strip.height != numLinesToProcess) {
+		// Decode the raw color indices. Pixels skipped by a transparent
+		// codec keep the transparent color, so they are skipped again
+		// when the strip gets replayed below.
+		strip.pixels.resize(8 * numLinesToProcess);
+		memset(strip.pixels.data(), _transparentColor, strip.pixels.size());
+
+		byte *roomPalette = _roomPalette;
+		uint32 vertStripNextInc = _vertStripNextInc;
+		_roomPalette = _identityPalette;
+		_vertStripNextInc = numLinesToProcess * 8 - 1;
+		strip.transpStrip = decompressBitmap(strip.pixels.data(), 8, src, numLinesToProcess);
+		_roomPalette = roomPalette;
+		_vertStripNextInc = vertStripNextInc;
+
+		strip.src = src;
+		strip.height = numLinesToProcess;
+	}
+
+	const byte *pixels = strip.pixels.data();
+	for (int y = 0; y < numLinesToProcess; y++) {
+		for (int x = 0; x < 8; x++) {
+			const byte color = *pixels++;
+			if (!strip.transpStrip || color != _transparentColor)
+				writeRoomColor(dst + x, color);
+		}
+		dst += dstPitch;
+	}
+
+	return strip.transpStrip;
+}
+
 void Gdi::decompressMaskImg(byte *dst, const byte *src, int height) const {
 	byte b, c;
 
@@ -4006,7 +4088,30 @@ void Gdi::drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) con
 	}
 }
 
-#define READ_BIT (shift--, dataBit = data & 1, data >>= 1, dataBit)
+/**
+ * Number of consecutive zero bits at the bottom of a byte, i.e. the number of
+ * "keep the current color" codes which the strip decoders below can consume
+ * with a single lookup. A zero byte yields 8, meaning "at least 8".
+ */
+static const byte zeroRunLength[256] = {
+	8, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	7, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0
+};
+
 #define FILL_BITS(n) do {            \
 		if (shift < n) {             \
 			data |= *src++ << shift; \
@@ -4017,7 +4122,8 @@ void Gdi::drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) con
 // NOTE: drawStripHE is actually very similar to drawStripComplex
 void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const {
 	static const int delta_color[] = { -4, -3, -2, -1, 1, 2, 3, 4 };
-	uint32 dataBit, data;
+	const int bpp = _vm->_bytesPerPixel;
+	uint32 data;
 	byte color;
 	int shift;
 
@@ -4030,34 +4136,72 @@ void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int h
 	while (1) {
 		if (!transpCheck || color != _transparentColor)
 			writeRoomColor(dst, color);
-		dst += _vm->_bytesPerPixel;
+		dst += bpp;
 		--x;
 		if (x == 0) {
 			x = width;
-			dst += dstPitch - width * _vm->_bytesPerPixel;
+			dst += dstPitch - width * bpp;
 			--height;
 			if (height == 0)
 				return;
 		}
-		FILL_BITS(1);
-		if (READ_BIT) {
+		// Every remaining pixel takes at least one bit, so with 8 or more
+		// pixels left a full byte can be buffered without reading past the
+		// strip, and every code (prefix plus payload) looked up at once.
+		if (x + (height - 1) * width < 8) {
+			// Near the end of the strip, only read the bits the code needs
 			FILL_BITS(1);
-			if (READ_BIT) {
-				FILL_BITS(3);
-				color += delta_color[data & 7];
-				shift -= 3;
-				data >>= 3;
+			const bool newColor = data & 1;
+			shift--;
+			data >>= 1;
+			if (newColor) {
+				FILL_BITS(1);
+				const bool delta = data & 1;
+				shift--;
+				data >>= 1;
+				if (delta) {
+					FILL_BITS(3);
+					color += delta_color[data & 7];
+					shift -= 3;
+					data >>= 3;
+				} else {
+					FILL_BITS(_decomp_shr);
+					color = data & _decomp_mask;
+					shift -= _decomp_shr;
+					data >>= _decomp_shr;
+				}
+			}
+			continue;
+		}
+		FILL_BITS(8);
+		if (!(data & 1)) {
+			// A run of "same color" codes; emit all but the last pixel of
+			// the run right here, staying within the current row.
+			const int run = MIN<int>(zeroRunLength[data & 0xFF], x);
+			data >>= run;
+			shift -= run;
+			if (!transpCheck || color != _transparentColor) {
+				for (int i = 1; i < run; i++, dst += bpp)
+					writeRoomColor(dst, color);
 			} else {
-				FILL_BITS(_decomp_shr);
-				color = data & _decomp_mask;
-				shift -= _decomp_shr;
-				data >>= _decomp_shr;
+				dst += (run - 1) * bpp;
 			}
+			x -= run - 1;
+		} else if (data & 2) {
+			color += delta_color[(data >> 2) & 7];
+			shift -= 5;
+			data >>= 5;
+		} else {
+			shift -= 2;
+			data >>= 2;
+			FILL_BITS(_decomp_shr);
+			color = data & _decomp_mask;
+			shift -= _decomp_shr;
+			data >>= _decomp_shr;
 		}
 	}
 }
 
-#undef READ_BIT
 #undef FILL_BITS
 
 
@@ -4098,7 +4242,6 @@ void Gdi::drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height, con
 }
 
 
-#define READ_BIT (cl--, bit = bits & 1, bits >>= 1, bit)
 #define FILL_BITS do {              \
 		if (cl <= 8) {              \
 			bits |= (*src++ << cl); \
@@ -4128,10 +4271,10 @@ void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height,
 }
 
 void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+	const int bpp = _vm->_bytesPerPixel;
 	byte color = *src++;
 	uint bits = *src++;
 	byte cl = 8;
-	byte bit;
 	int8 inc = -1;
 
 	do {
@@ -4140,22 +4283,51 @@ void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height,
 			FILL_BITS;
 			if (!transpCheck || color != _transparentColor)
 				writeRoomColor(dst, color);
-			dst += _vm->_bytesPerPixel;
-			if (!READ_BIT) {
-			} else if (!READ_BIT) {
+			dst += bpp;
+			// FILL_BITS leaves at least 9 bits buffered, so the whole code
+			// prefix (and any run of "same color" codes up to the end of
+			// the row) is decoded from the low bits in one step.
+			switch (bits & 7) {
+			case 0:
+			case 2:
+			case 4:
+			case 6: {
+				const int run = MIN<int>(zeroRunLength[bits & 0xFF], x);
+				bits >>= run;
+				cl -= run;
+				if (!transpCheck || color != _transparentColor) {
+					for (int i = 1; i < run; i++, dst += bpp)
+						writeRoomColor(dst, color);
+				} else {
+					dst += (run - 1) * bpp;
+				}
+				x -= run - 1;
+				break;
+			}
+			case 1:
+			case 5:
+				bits >>= 2;
+				cl -= 2;
 				FILL_BITS;
 				color = bits & _decomp_mask;
 				bits >>= _decomp_shr;
 				cl -= _decomp_shr;
 				inc = -1;
-			} else if (!READ_BIT) {
+				break;
+			case 3:
+				bits >>= 3;
+				cl -= 3;
 				color += inc;
-			} else {
+				break;
+			default:
+				bits >>= 3;
+				cl -= 3;
 				inc = -inc;
 				color += inc;
+				break;
 			}
 		} while (--x);
-		dst += dstPitch - 8 * _vm->_bytesPerPixel;
+		dst += dstPitch - 8 * bpp;
 	} while (--height);
 }
 
@@ -4163,7 +4335,6 @@ void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height,
 	byte color = *src++;
 	uint bits = *src++;
 	byte cl = 8;
-	byte bit;
 	int8 inc = -1;
 
 	int x = 8;
@@ -4174,25 +4345,50 @@ void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height,
 			if (!transpCheck || color != _transparentColor)
 				writeRoomColor(dst, color);
 			dst += dstPitch;
-			if (!READ_BIT) {
-			} else if (!READ_BIT) {
+			switch (bits & 7) {
+			case 0:
+			case 2:
+			case 4:
+			case 6: {
+				const int run = MIN<int>(zeroRunLength[bits & 0xFF], h);
+				bits >>= run;
+				cl -= run;
+				if (!transpCheck || color != _transparentColor) {
+					for (int i = 1; i < run; i++, dst += dstPitch)
+						writeRoomColor(dst, color);
+				} else {
+					dst += (run - 1) * dstPitch;
+				}
+				h -= run - 1;
+				break;
+			}
+			case 1:
+			case 5:
+				bits >>= 2;
+				cl -= 2;
 				FILL_BITS;
 				color = bits & _decomp_mask;
 				bits >>= _decomp_shr;
 				cl -= _decomp_shr;
 				inc = -1;
-			} else if (!READ_BIT) {
+				break;
+			case 3:
+				bits >>= 3;
+				cl -= 3;
 				color += inc;
-			} else {
+				break;
+			default:
+				bits >>= 3;
+				cl -= 3;
 				inc = -inc;
 				color += inc;
+				break;
 			}
 		} while (--h);
 		dst -= _vertStripNextInc;
 	} while (--x);
 }
 
-#undef READ_BIT
 #undef FILL_BITS
 
 /* Ender - Zak256/Indy256 decoders */
@@ -5006,30 +5202,49 @@ void MajMinCodec::decodeLine(byte *buf, int32 numbytes, int32 dir) {
 	byte diff;
 
 	while (numbytes != 0) {
+		if (_majMinData.repeatMode) {
+			// Flush as much of the pending repeat run as fits in this line
+			// at once. A non-positive count never terminates the run, just
+			// like in the per-pixel loop below.
+			int32 run = numbytes;
+			if (_majMinData.repeatCount > 0 && _majMinData.repeatCount < run)
+				run = _majMinData.repeatCount;
+			if (buf) {
+				if (dir == 1) {
+					memset(buf, _majMinData.color, run);
+					buf += run;
+				} else {
+					for (int32 i = 0; i < run; i++, buf += dir)
+						*buf = _majMinData.color;
+				}
+			}
+			if (_majMinData.repeatCount > 0) {
+				_majMinData.repeatCount -= run;
+				if (_majMinData.repeatCount == 0)
+					_majMinData.repeatMode = false;
+			}
+			numbytes -= run;
+			continue;
+		}
+
 		if (buf) {
 			*buf = _majMinData.color;
 			buf += dir;
 		}
 
-		if (!_majMinData.repeatMode) {
+		if (readBits(1)) {
 			if (readBits(1)) {
-				if (readBits(1)) {
-					diff = readBits(3) - 4;
-					if (diff) {
-						// A color change
-						_majMinData.color += diff;
-					} else {
-						// Color does not change, but rather identical pixels get repeated
-						_majMinData.repeatMode = true;
-						_majMinData.repeatCount = readBits(8) - 1;
-					}
+				diff = readBits(3) - 4;
+				if (diff) {
+					// A color change
+					_majMinData.color += diff;
 				} else {
-					_majMinData.color = readBits(_majMinData.shift);
+					// Color does not change, but rather identical pixels get repeated
+					_majMinData.repeatMode = true;
+					_majMinData.repeatCount = readBits(8) - 1;
 				}
-			}
-		} else {
-			if (--_majMinData.repeatCount == 0) {
-				_majMinData.repeatMode = false;
+			} else {
+				_majMinData.color = readBits(_majMinData.shift);
 			}
 		}
 		numbytes--;
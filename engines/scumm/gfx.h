@@ -23,6 +23,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -304,6 +305,27 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true while the room background is being (re)drawn. */
+	bool _roomBackgroundMode;
+
+	/**
+	 * Decoded room background strip. Holds the room color indices as they
+	 * came out of the decompressor (before the room palette is applied), so
+	 * that scrolling back over already visited strips only costs a palette
+	 * lookup instead of another decompression pass.
+	 */
+	struct CachedStrip {
+		const byte *src;
+		int height;
+		bool transpStrip;
+		Common::Array<byte> pixels;
+
+		CachedStrip() : src(nullptr), height(0), transpStrip(false) {}
+	};
+
+	Common::Array<CachedStrip> _stripCache;
+	byte _identityPalette[256];
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -315,6 +337,9 @@ public:
 protected:
 	/* Bitmap decompressors */
 	bool decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess);
+	bool decompressCachedBitmap(byte *dst, int dstPitch, int stripnr, const byte *src, int numLinesToProcess);
+	bool isStripCacheable(const byte *src) const;
+	void flushStripCache();
 
 	void drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) const;
 
@@ -378,9 +403,10 @@ public:
 	void resetBackground(int top, int bottom, int strip);
 
 	enum DrawBitmapFlags {
-		dbAllowMaskOr   = 1 << 0,
-		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbAllowMaskOr    = 1 << 0,
+		dbDrawMaskOnAll  = 1 << 1,
+		dbObjectMode     = 2 << 2,
+		dbRoomBackground = 1 << 4
 	};
 };
 
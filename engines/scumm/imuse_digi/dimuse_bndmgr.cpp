@@ -36,6 +36,7 @@ BundleDirCache::BundleDirCache(const ScummEngine *vm) : _vm(vm) {
 		_bundleDirCache[fileId].numFiles = 0;
 		_bundleDirCache[fileId].isCompressed = false;
 		_bundleDirCache[fileId].indexTable = nullptr;
+		_bundleDirCache[fileId].compIndex = nullptr;
 	}
 }
 
@@ -43,6 +44,11 @@ BundleDirCache::~BundleDirCache() {
 	for (int fileId = 0; fileId < ARRAYSIZE(_bundleDirCache); fileId++) {
 		free(_bundleDirCache[fileId].bundleTable);
 		free(_bundleDirCache[fileId].indexTable);
+		if (_bundleDirCache[fileId].compIndex) {
+			for (int32 i = 0; i < _bundleDirCache[fileId].numFiles; i++)
+				free(_bundleDirCache[fileId].compIndex[i].compTable);
+			free(_bundleDirCache[fileId].compIndex);
+		}
 	}
 }
 
@@ -62,6 +68,11 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _bundleDirCache[slot].isCompressed;
 }
 
+BundleDirCache::CompIndex *BundleDirCache::getCompIndex(int slot, int32 index) {
+	assert(0 <= index && index < _bundleDirCache[slot].numFiles);
+	return &_bundleDirCache[slot].compIndex[index];
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -105,6 +116,11 @@ int BundleDirCache::matchFile(const char *filename) {
 				(IndexNode *)calloc(_bundleDirCache[freeSlot].numFiles, sizeof(IndexNode));
 		assert(_bundleDirCache[freeSlot].indexTable);
 
+		// Filled in lazily by BundleMgr::loadCompTable()
+		_bundleDirCache[freeSlot].compIndex =
+				(CompIndex *)calloc(_bundleDirCache[freeSlot].numFiles, sizeof(CompIndex));
+		assert(_bundleDirCache[freeSlot].compIndex);
+
 		for (int32 i = 0; i < _bundleDirCache[freeSlot].numFiles; i++) {
 			char name[24], c;
 			int32 z = 0;
@@ -148,6 +164,7 @@ BundleMgr::BundleMgr(const ScummEngine *vm, BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile(vm);
 	_compInputBuff = nullptr;
+	flushDecodedBlocks();
 }
 
 BundleMgr::~BundleMgr() {
@@ -185,6 +202,7 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_fileBundleId = slot;
 	isCompressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -193,10 +211,9 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_isUncompressed = false;
-	_outputSize = 0;
 	_lastBlockDecompressedSize = 0;
 	_curDecompressedFilePos = 0;
-	_lastBlock = -1;
+	flushDecodedBlocks();
 
 	return true;
 }
@@ -211,52 +228,104 @@ void BundleMgr::close() {
 		_curDecompressedFilePos = 0;
 		_compTableLoaded = false;
 		_isUncompressed = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
-		free(_compTable);
+		_fileBundleId = -1;
 		_compTable = nullptr;
 		free(_compInputBuff);
 		_compInputBuff = nullptr;
+		flushDecodedBlocks();
 	}
 }
 
+void BundleMgr::flushDecodedBlocks() {
+	for (int i = 0; i < kNumDecodedBlocks; i++) {
+		_decodedBlocks[i].block = -1;
+		_decodedBlocks[i].size = 0;
+	}
+	_nextDecodedBlock = 0;
+}
+
 bool BundleMgr::loadCompTable(int32 index) {
-	_file->seek(_bundleTable[index].offset, SEEK_SET);
-	uint32 tag = _file->readUint32BE();
+	BundleDirCache::CompIndex *compIndex = _cache->getCompIndex(_fileBundleId, index);
+
+	if (!compIndex->loaded) {
+		_file->seek(_bundleTable[index].offset, SEEK_SET);
+		uint32 tag = _file->readUint32BE();
+
+		if (tag == MKTAG('i','M','U','S')) {
+			compIndex->isUncompressed = true;
+		} else {
+			int32 numCompItems = _file->readUint32BE();
+			assert(numCompItems > 0);
+			_file->seek(4, SEEK_CUR);
+			int32 lastBlockDecompressedSize = _file->readUint32BE();
+			if (tag != MKTAG('C','O','M','P')) {
+				debug("BundleMgr::loadCompTable() Compressed sound %d (%s:%d) invalid (%s)", index, _file->getDebugName().c_str(), _bundleTable[index].offset, tag2str(tag));
+				return false;
+			}
+
+			BundleDirCache::CompTable *compTable = (BundleDirCache::CompTable *)malloc(sizeof(BundleDirCache::CompTable) * numCompItems);
+			assert(compTable);
+			int32 maxSize = 0;
+			for (int i = 0; i < numCompItems; i++) {
+				compTable[i].offset = _file->readUint32BE();
+				compTable[i].size = _file->readUint32BE();
+				compTable[i].codec = _file->readUint32BE();
+				_file->seek(4, SEEK_CUR);
+				if (compTable[i].size > maxSize)
+					maxSize = compTable[i].size;
+			}
+
+			compIndex->numCompItems = numCompItems;
+			compIndex->lastBlockDecompressedSize = lastBlockDecompressedSize;
+			compIndex->maxCompSize = maxSize;
+			compIndex->compTable = compTable;
+		}
 
-	if (tag == MKTAG('i','M','U','S')) {
+		compIndex->loaded = true;
+	}
+
+	if (compIndex->isUncompressed) {
 		_isUncompressed = true;
 		return true;
 	}
 
-	_numCompItems = _file->readUint32BE();
-	assert(_numCompItems > 0);
-	_file->seek(4, SEEK_CUR);
-	_lastBlockDecompressedSize = _file->readUint32BE();
-	if (tag != MKTAG('C','O','M','P')) {
-		debug("BundleMgr::loadCompTable() Compressed sound %d (%s:%d) invalid (%s)", index, _file->getDebugName().c_str(), _bundleTable[index].offset, tag2str(tag));
-		return false;
-	}
+	_numCompItems = compIndex->numCompItems;
+	_lastBlockDecompressedSize = compIndex->lastBlockDecompressedSize;
+	_compTable = compIndex->compTable;
 
-	_compTable = (CompTable *)malloc(sizeof(CompTable) * _numCompItems);
-	assert(_compTable);
-	int32 maxSize = 0;
-	for (int i = 0; i < _numCompItems; i++) {
-		_compTable[i].offset = _file->readUint32BE();
-		_compTable[i].size = _file->readUint32BE();
-		_compTable[i].codec = _file->readUint32BE();
-		_file->seek(4, SEEK_CUR);
-		if (_compTable[i].size > maxSize)
-			maxSize = _compTable[i].size;
-	}
 	// CMI hack: one more byte at the end of input buffer
-	_compInputBuff = (byte *)malloc(maxSize + 1);
+	_compInputBuff = (byte *)malloc(compIndex->maxCompSize + 1);
 	assert(_compInputBuff);
 
 	return true;
 }
 
+const BundleMgr::DecodedBlock *BundleMgr::decodeBlock(int32 index, int32 block) {
+	for (int i = 0; i < kNumDecodedBlocks; i++) {
+		if (_decodedBlocks[i].block == block)
+			return &_decodedBlocks[i];
+	}
+
+	// Replace the oldest block; streams mostly move forward, and loops
+	// jumping back a short distance still find their blocks above.
+	DecodedBlock *decoded = &_decodedBlocks[_nextDecodedBlock];
+	_nextDecodedBlock = (_nextDecodedBlock + 1) % kNumDecodedBlocks;
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	decoded->size = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, decoded->data, _compTable[block].size);
+
+	if (decoded->size > DIMUSE_BUN_CHUNK_SIZE) {
+		error("BundleMgr::decodeBlock(): Block %d decoded to %d bytes, more than the %d byte chunk size", block, decoded->size, DIMUSE_BUN_CHUNK_SIZE);
+	}
+	decoded->block = block;
+
+	return decoded;
+}
+
 int32 BundleMgr::seekFile(int32 offset, int mode) {
 	// We don't actually seek the file, but instead try to find that the specified offset exists
 	// within the decompressed blocks, and save that offset in _curDecompressedFilePos
@@ -349,20 +418,9 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 		skip = (_curDecompressedFilePos + headerSize) % DIMUSE_BUN_CHUNK_SIZE; // Excess length after the last block
 
 		for (i = firstBlock; i <= lastBlock; i++) {
-			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
-				}
-				_lastBlock = i;
-			}
+			const DecodedBlock *decoded = decodeBlock(found->index, i);
 
-			outputSize = _outputSize;
+			outputSize = decoded->size;
 
 			if (header_outside) {
 				outputSize -= skip;
@@ -379,7 +437,7 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 			assert(finalSize + outputSize <= blocksFinalSize);
 
-			memcpy(*comp_final + finalSize, _compOutputBuff + skip, outputSize);
+			memcpy(*comp_final + finalSize, decoded->data + skip, outputSize);
 			finalSize += outputSize;
 
 			size -= outputSize;
@@ -43,6 +43,27 @@ public:
 		int32 index;
 	};
 
+	struct CompTable {
+		int32 offset;
+		int32 size;
+		int32 codec;
+	};
+
+	/**
+	 * Block table of a single sound within a bundle. It is read from the
+	 * sound's COMP header the first time the sound gets opened and then kept
+	 * alongside the bundle directory, so that restarting a sound (or playing
+	 * it on another track) doesn't seek back to its header.
+	 */
+	struct CompIndex {
+		bool loaded;
+		bool isUncompressed;
+		int32 numCompItems;
+		int32 lastBlockDecompressedSize;
+		int32 maxCompSize;
+		CompTable *compTable;
+	};
+
 private:
 
 	struct FileDirCache {
@@ -51,6 +72,7 @@ private:
 		int32 numFiles;
 		bool isCompressed;
 		IndexNode *indexTable;
+		CompIndex *compIndex;
 	} _bundleDirCache[4];
 
 	const ScummEngine *_vm;
@@ -63,21 +85,25 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+	CompIndex *getCompIndex(int slot, int32 index);
 };
 
 class BundleMgr {
 
 private:
-	struct CompTable {
-		int32 offset;
+	/** Number of decompressed blocks kept around by each bundle stream. */
+	static const int kNumDecodedBlocks = 4;
+
+	struct DecodedBlock {
+		int32 block;
 		int32 size;
-		int32 codec;
+		byte data[DIMUSE_BUN_CHUNK_SIZE];
 	};
 
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable = nullptr;
-	CompTable *_compTable;
+	BundleDirCache::CompTable *_compTable;
 
 	int _numFiles = 0;
 	int _numCompItems = 0;
@@ -88,11 +114,12 @@ private:
 	bool _compTableLoaded = 0;
 	bool _isUncompressed = 0;
 	int _fileBundleId = 0;
-	byte _compOutputBuff[0x2000] = {};
+	DecodedBlock _decodedBlocks[kNumDecodedBlocks] = {};
+	int _nextDecodedBlock = 0;
 	byte *_compInputBuff = nullptr;
-	int _outputSize = 0;
-	int _lastBlock = 0;
 	bool loadCompTable(int32 index);
+	const DecodedBlock *decodeBlock(int32 index, int32 block);
+	void flushDecodedBlocks();
 
 public:
 
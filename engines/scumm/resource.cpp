@@ -23,6 +23,7 @@
 #include "common/str.h"
 #include "common/memstream.h"
 #include "common/macresman.h"
+#include "common/tokenizer.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
 #endif
@@ -49,6 +50,7 @@ enum {
 	RF_USAGE_MAX = RF_USAGE,
 
 	RS_MODIFIED = 0x10,
+	RS_EXPIRED = 0x20,
 	RF_OFFHEAP = 0x40
 };
 
@@ -774,7 +776,9 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return nullptr;
 
 	// If the resource is missing, but loadable from the game data files, try to do so.
-	if (!_res->_types[type][idx]._address && _res->_types[type]._mode != kDynamicResTypeMode) {
+	const bool cached = _res->_types[type][idx]._address != nullptr;
+	if (!cached && _res->_types[type]._mode != kDynamicResTypeMode) {
+		_res->_types[type]._stats.misses++;
 		ensureResourceLoaded(type, idx);
 	}
 
@@ -784,6 +788,9 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return nullptr;
 	}
 
+	if (cached)
+		_res->_types[type]._stats.hits++;
+
 	_res->setResourceCounter(type, idx, 1);
 
 	debugC(DEBUG_RESOURCE, "getResourceAddress(%s,%d) == %p", nameOfResType(type), idx, (void *)ptr);
@@ -862,8 +869,11 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 			return _types[type][idx]._address;
 	}
 
+	const bool reloaded = _types[type][idx].isExpired();
+
 	nukeResource(type, idx);
 
+	expireResourcesOfType(type, size);
 	expireResources(size);
 
 	byte *ptr = new byte[size + SAFETY_AREA]();
@@ -872,6 +882,12 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	}
 
 	_allocatedSize += size;
+	_types[type]._allocatedSize += size;
+
+	if (reloaded) {
+		_types[type]._stats.reloads++;
+		_types[type]._stats.bytesReloaded += size;
+	}
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
@@ -907,6 +923,8 @@ void ResourceManager::Resource::nuke() {
 ResourceManager::ResTypeData::ResTypeData() {
 	_mode = kDynamicResTypeMode;
 	_tag = 0;
+	_budget = 0;
+	_allocatedSize = 0;
 }
 
 ResourceManager::ResTypeData::~ResTypeData() {
@@ -931,6 +949,46 @@ void ResourceManager::setHeapThreshold(int min, int max) {
 	_minHeapThreshold = min;
 }
 
+void ResourceManager::setTypeBudget(ResType type, uint32 budget) {
+	assert(type >= rtFirst && type <= rtLast);
+	_types[type]._budget = budget;
+}
+
+/**
+ * Set the budgets from a comma separated list of <type>=<KB> entries,
+ * e.g. "Costume=512,Sound=1024", as given by the resource_budgets key.
+ */
+void ResourceManager::setTypeBudgets(const Common::String &budgets) {
+	Common::StringTokenizer tokenizer(budgets, ",");
+	while (!tokenizer.empty()) {
+		Common::String entry = tokenizer.nextToken();
+		size_t separator = entry.findFirstOf('=');
+		if (separator == Common::String::npos) {
+			warning("Invalid resource budget '%s'", entry.c_str());
+			continue;
+		}
+
+		Common::String typeName = entry.substr(0, separator);
+		typeName.trim();
+		ResType type;
+		for (type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+			if (!typeName.compareToIgnoreCase(nameOfResType(type)))
+				break;
+		}
+		if (type > rtLast) {
+			warning("Unknown resource type '%s' in resource budgets", typeName.c_str());
+			continue;
+		}
+
+		setTypeBudget(type, atoi(entry.c_str() + separator + 1) * 1024);
+	}
+}
+
+void ResourceManager::resetResourceStats() {
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1))
+		_types[type]._stats.reset();
+}
+
 bool ResourceManager::validateResource(const char *str, ResType type, ResId idx) const {
 	if (type < rtFirst || type > rtLast || (uint)idx >= (uint)_types[type].size()) {
 		warning("%s Illegal Glob type %s (%d) num %d", str, nameOfResType(type), type, idx);
@@ -942,9 +1000,11 @@ bool ResourceManager::validateResource(const char *str, ResType type, ResId idx)
 void ResourceManager::nukeResource(ResType type, ResId idx) {
 	Common::StackLock lock(*_mutex);
 	byte *ptr = _types[type][idx]._address;
+	_types[type][idx].setExpired(false);
 	if (ptr != nullptr) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
+		_types[type]._allocatedSize -= _types[type][idx]._size;
 		_types[type][idx].nuke();
 	}
 }
@@ -1084,14 +1144,98 @@ void ResourceManager::Resource::setOffHeap() {
 	_status |= RF_OFFHEAP;
 }
 
+void ResourceManager::Resource::setExpired(bool expired) {
+	if (expired)
+		_status |= RS_EXPIRED;
+	else
+		_status &= ~RS_EXPIRED;
+}
+
+bool ResourceManager::Resource::isExpired() const {
+	return (_status & RS_EXPIRED) != 0;
+}
+
 void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+uint32 ResourceManager::getExpireScore(ResType type, const Resource &res) const {
+	// Rough cost of bringing a resource of this type back into memory:
+	// room data means seeking into the room and reading large blocks, and
+	// costumes and images are also big and requested on every frame.
+	uint32 reloadCost;
+	switch (type) {
+	case rtRoom:
+	case rtRoomImage:
+	case rtRoomScripts:
+		reloadCost = 8;
+		break;
+	case rtCostume:
+	case rtImage:
+		reloadCost = 4;
+		break;
+	case rtSound:
+	case rtCharset:
+		reloadCost = 2;
+		break;
+	default:
+		reloadCost = 1;
+		break;
+	}
+
+	// Resources which haven't been used for a long time, and which give
+	// back a lot of memory, are the best candidates.
+	return res.getResourceCounter() * (res._size / 1024 + 1) * 16 / reloadCost;
+}
+
+bool ResourceManager::expireResource(ResType onlyType) {
+	ResType bestType = rtInvalid;
+	ResId bestRes = 0;
+	uint32 bestScore = 0;
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		if (onlyType != rtInvalid && type != onlyType)
+			continue;
+
+		if (_types[type]._mode != kDynamicResTypeMode) {
+			// Resources of this type can be reloaded from the data files,
+			// so we can potentially unload them to free memory.
+			ResId idx = _types[type].size();
+			while (idx-- > 0) {
+				Resource &tmp = _types[type][idx];
+				if (!tmp.isLocked() && tmp.getResourceCounter() >= 2 && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+					uint32 score = getExpireScore(type, tmp);
+					if (score > bestScore) {
+						bestScore = score;
+						bestType = type;
+						bestRes = idx;
+					}
+				}
+			}
+		}
+	}
+
+	if (!bestType)
+		return false;
+
+	_types[bestType]._stats.evictions++;
+	_types[bestType]._stats.bytesEvicted += _types[bestType][bestRes]._size;
+	nukeResource(bestType, bestRes);
+	_types[bestType][bestRes].setExpired(true);
+	return true;
+}
+
+void ResourceManager::expireResourcesOfType(ResType type, uint32 size) {
+	if (!_types[type]._budget || _types[type]._mode == kDynamicResTypeMode)
+		return;
+
+	while (size + _types[type]._allocatedSize > _types[type]._budget) {
+		if (!expireResource(type))
+			break;
+	}
+}
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1105,29 +1249,8 @@ void ResourceManager::expireResources(uint32 size) {
 	oldAllocatedSize = _allocatedSize;
 
 	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
-		}
-
-		if (!best_type)
+		if (!expireResource(rtInvalid))
 			break;
-		nukeResource(best_type, best_res);
 	} while (size + _allocatedSize > _minHeapThreshold);
 
 	increaseResourceCounters();
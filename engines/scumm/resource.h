@@ -85,6 +85,23 @@ protected:
 	Common::Mutex *_mutex;
 
 public:
+	/**
+	 * Usage counters kept for each resource type, to tell whether the heap
+	 * thresholds and budgets are too tight for a game (see the debugger's
+	 * "resources" command).
+	 */
+	struct ResTypeStats {
+		uint32 hits;          ///< Accesses to a resource that was in memory
+		uint32 misses;        ///< Accesses that had to load the resource
+		uint32 reloads;       ///< Loads of a resource that had been expired before
+		uint32 bytesReloaded; ///< Bytes read again because of those reloads
+		uint32 evictions;     ///< Resources expired to make room for others
+		uint32 bytesEvicted;  ///< Bytes freed by those evictions
+
+		ResTypeStats() { reset(); }
+		void reset() { hits = misses = reloads = bytesReloaded = evictions = bytesEvicted = 0; }
+	};
+
 	class Resource {
 	public:
 		/**
@@ -150,6 +167,9 @@ public:
 		void setOffHeap();
 		void setOnHeap();
 		bool isOffHeap() const;
+
+		void setExpired(bool expired);
+		bool isExpired() const;
 	};
 
 	/**
@@ -170,6 +190,20 @@ public:
 		 */
 		uint32 _tag;
 
+		/**
+		 * Memory budget in bytes for all resources of this type, 0 if the type
+		 * is only limited by the overall heap thresholds. When a new resource
+		 * would exceed it, older resources of the same type get expired first.
+		 */
+		uint32 _budget;
+
+		/**
+		 * Number of bytes currently allocated for resources of this type.
+		 */
+		uint32 _allocatedSize;
+
+		ResTypeStats _stats;
+
 	public:
 		ResTypeData();
 		~ResTypeData();
@@ -188,6 +222,10 @@ public:
 	void setHeapThreshold(int min, int max);
 	uint32 getHeapSize() { return _allocatedSize; }
 
+	void setTypeBudget(ResType type, uint32 budget);
+	void setTypeBudgets(const Common::String &budgets);
+	void resetResourceStats();
+
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
 
@@ -236,6 +274,9 @@ public:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+	void expireResourcesOfType(ResType type, uint32 size);
+	bool expireResource(ResType onlyType);
+	uint32 getExpireScore(ResType type, const Resource &res) const;
 };
 
 } // End of namespace Scumm
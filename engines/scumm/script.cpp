@@ -20,6 +20,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -958,6 +959,7 @@ void ScummEngine::unfreezeScripts() {
 
 
 void ScummEngine::runAllScripts() {
+	PROFILE_SCOPE("ScummEngine::runAllScripts");
 	int i;
 
 	for (i = 0; i < NUM_SCRIPT_SLOT; i++)
@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/profiler.h"
 #include "ultima/ultima8/misc/debugger.h"
 #include "ultima/ultima8/kernel/kernel.h"
 #include "ultima/ultima8/kernel/process.h"
@@ -143,6 +144,8 @@ ProcId Kernel::addProcessExec(Process *proc, bool dispose) {
 }
 
 void Kernel::runProcesses() {
+	PROFILE_SCOPE("Kernel::runProcesses");
+
 	if (!_paused)
 		_tickNum++;
 
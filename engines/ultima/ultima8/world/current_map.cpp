@@ -46,7 +46,7 @@
 namespace Ultima {
 namespace Ultima8 {
 
-typedef Std::list<Item *> item_list;
+typedef Std::vector<Item *> item_list;
 
 const int INT_MAX_VALUE = 0x7fffffff;
 const int INT_MIN_VALUE = -INT_MAX_VALUE - 1;
@@ -247,7 +247,7 @@ void CurrentMap::addItem(Item *item) {
 	}
 #endif
 
-	_items[cx][cy].push_front(item);
+	_items[cx][cy].insert_at(0, item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -393,7 +393,10 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cx = oldx / _mapChunkSize;
 	int32 cy = oldy / _mapChunkSize;
 
-	_items[cx][cy].remove(item);
+	item_list &items = _items[cx][cy];
+	item_list::iterator iter = Common::find(items.begin(), items.end(), item);
+	if (iter != items.end())
+		items.erase(iter);
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
@@ -506,7 +509,9 @@ void CurrentMap::updateFastArea(const Point3 &from, const Point3 &to) {
 void CurrentMap::setChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] |= 1 << (cx & 31);
 
-	for (auto *item : _items[cx][cy]) {
+	// Work on a copy, entering the fast area may add items to this chunk
+	const item_list items = _items[cx][cy];
+	for (auto *item : items) {
 		item->enterFastArea();
 	}
 }
@@ -514,8 +519,10 @@ void CurrentMap::setChunkFast(int32 cx, int32 cy) {
 void CurrentMap::unsetChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] &= ~(1 << (cx & 31));
 
-	item_list::iterator iter = _items[cx][cy].begin();
-	while (iter != _items[cx][cy].end()) {
+	// Work on a copy, leaving the fast area may remove items from this chunk
+	const item_list items = _items[cx][cy];
+	item_list::const_iterator iter = items.begin();
+	while (iter != items.end()) {
 		Item *item = *iter;
 		++iter;
 #ifdef VALIDATE_CHUNKS
@@ -674,7 +681,7 @@ TeleportEgg *CurrentMap::findDestination(uint16 id) {
 	return nullptr;
 }
 
-const Std::list<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
+const Std::vector<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
 	if (gx < 0 || gy < 0 || gx >= MAP_NUM_CHUNKS || gy >= MAP_NUM_CHUNKS)
 		return nullptr;
 	return &_items[gx][gy];
@@ -39,16 +39,28 @@
 
 #include "ultima/ultima8/world/sort_item.h"
 
+#include "common/algorithm.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+// Size in pixels of the screenspace cells used to find overlap candidates
+static const int32 SORT_CELL_SIZE = 64;
+// Spacing of list positions, leaving room for inserts between neighbours
+static const int64 LIST_POS_GAP = 1 << 16;
+
+static bool listPosLessThan(const SortItem *si1, const SortItem *si2) {
+	return si1->_listPos < si2->_listPos;
+}
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
 	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
-	_sortLimit(0), _sortLimitChanged(false) {
+	_sortLimit(0), _sortLimitChanged(false), _cellCols(0), _cellRows(0),
+	_cellStamp(0), _itemCount(0), _comparisons(0) {
 	int i = capacity;
 	while (i--) {
 		SortItem *next = _itemsUnused;
@@ -88,6 +100,20 @@ void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	_itemsTail = nullptr;
 	_painted = nullptr;
 
+	_itemCount = 0;
+	_comparisons = 0;
+	_keyHeads.resize(0);
+
+	int32 cols = MAX<int32>(1, (_clipWindow.width() + SORT_CELL_SIZE - 1) / SORT_CELL_SIZE);
+	int32 rows = MAX<int32>(1, (_clipWindow.height() + SORT_CELL_SIZE - 1) / SORT_CELL_SIZE);
+	if (cols != _cellCols || rows != _cellRows) {
+		_cellCols = cols;
+		_cellRows = rows;
+		_cells.resize(cols * rows);
+	}
+	for (uint i = 0; i < _cells.size(); i++)
+		_cells[i].resize(0);
+
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
@@ -187,14 +213,32 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Gather the items sharing a grid cell with us. Only those can overlap
+	// us, and visiting them in list order gives the same result as
+	// comparing against the whole list.
+	int32 cellLeft, cellTop, cellRight, cellBottom;
+	getCellRange(si->_sr, cellLeft, cellTop, cellRight, cellBottom);
+
+	_cellStamp++;
+	_candidates.resize(0);
+	for (int32 cy = cellTop; cy <= cellBottom; cy++) {
+		for (int32 cx = cellLeft; cx <= cellRight; cx++) {
+			const Std::vector<SortItem *> &cell = _cells[cy * _cellCols + cx];
+			for (uint i = 0; i < cell.size(); i++) {
+				SortItem *si2 = cell[i];
+				if (si2->_cellStamp != _cellStamp) {
+					si2->_cellStamp = _cellStamp;
+					_candidates.push_back(si2);
+				}
+			}
+		}
+	}
+	Common::sort(_candidates.begin(), _candidates.end(), listPosLessThan);
 
-	// Ok,
-	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->listLessThan(*si2))
-			addpoint = si2;
+	// Iterate the candidates and compare _shapes
+	SortItem *occluder = nullptr;
+	for (uint i = 0; i < _candidates.size(); i++) {
+		SortItem *si2 = _candidates[i];
 
 		if (si2->_occluded)
 			continue;
@@ -221,11 +265,13 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 #endif // SORTITEM_OCCLUSION_EXPERIMENTAL
 
 		// Attempt to find paint dependency order
+		_comparisons++;
 		if (si->overlap(*si2)) {
 			if (si->below(*si2)) {
 				if (si2->_occl && si2->occludes(*si)) {
 					// No need to do any more checks, this isn't visible
 					si->_occluded = true;
+					occluder = si2;
 					break;
 				} else {
 					// si1 is behind si2, so add it to si2's dependency list
@@ -243,12 +289,51 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 		}
 	}
 
+	// Get the insert point... which is before the first item that has higher z than us
+	uint head = 0;
+	uint headCount = _keyHeads.size();
+	while (headCount > 0) {
+		uint step = headCount / 2;
+		if (!si->listLessThan(*_keyHeads[head + step])) {
+			head += step + 1;
+			headCount -= step + 1;
+		} else {
+			headCount = step;
+		}
+	}
+	SortItem *addpoint = head < _keyHeads.size() ? _keyHeads[head] : nullptr;
+
+	// A list walk stops at the item occluding us, so an insert point
+	// after it is never found and we end up at the end of the list.
+	bool inOrder = true;
+	if (addpoint && occluder && occluder->_listPos < addpoint->_listPos) {
+		addpoint = nullptr;
+		inOrder = false;
+	}
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
+	insertItem(si, addpoint);
+
+	if (inOrder && (head == 0 || _keyHeads[head - 1]->listLessThan(*si)))
+		_keyHeads.insert_at(head, si);
 
+	for (int32 cy = cellTop; cy <= cellBottom; cy++) {
+		for (int32 cx = cellLeft; cx <= cellRight; cx++)
+			_cells[cy * _cellCols + cx].push_back(si);
+	}
+	_itemCount++;
+}
+
+void ItemSorter::insertItem(SortItem *si, SortItem *addpoint) {
 	// have a position
-	//addpoint = 0;
 	if (addpoint) {
+		if (addpoint->_prev && addpoint->_listPos - addpoint->_prev->_listPos < 2)
+			renumberItems();
+
+		int64 prevPos = addpoint->_prev ? addpoint->_prev->_listPos : addpoint->_listPos - 2 * LIST_POS_GAP;
+		si->_listPos = prevPos + (addpoint->_listPos - prevPos) / 2;
+
 		si->_next = addpoint;
 		si->_prev = addpoint->_prev;
 		addpoint->_prev = si;
@@ -259,6 +344,8 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	}
 	// Add it to the end of the list
 	else {
+		si->_listPos = _itemsTail ? _itemsTail->_listPos + LIST_POS_GAP : 0;
+
 		if (_itemsTail)
 			_itemsTail->_next = si;
 		if (!_items)
@@ -269,6 +356,21 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	}
 }
 
+void ItemSorter::renumberItems() {
+	int64 pos = 0;
+	for (SortItem *si = _items; si != nullptr; si = si->_next) {
+		si->_listPos = pos;
+		pos += LIST_POS_GAP;
+	}
+}
+
+void ItemSorter::getCellRange(const Rect &r, int32 &left, int32 &top, int32 &right, int32 &bottom) const {
+	left = CLIP<int32>((r.left - _clipWindow.left) / SORT_CELL_SIZE, 0, _cellCols - 1);
+	right = CLIP<int32>((r.right - 1 - _clipWindow.left) / SORT_CELL_SIZE, 0, _cellCols - 1);
+	top = CLIP<int32>((r.top - _clipWindow.top) / SORT_CELL_SIZE, 0, _cellRows - 1);
+	bottom = CLIP<int32>((r.bottom - 1 - _clipWindow.top) / SORT_CELL_SIZE, 0, _cellRows - 1);
+}
+
 void ItemSorter::AddItem(const Item *add) {
 	AddItem(add->getLerped(), add->getShape(), add->getFrame(),
 			add->getFlags(), add->getExtFlags(), add->getObjId());
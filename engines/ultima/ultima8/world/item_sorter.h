@@ -23,6 +23,7 @@
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
 #include "ultima/ultima8/misc/rect.h"
+#include "ultima/shared/std/containers.h"
 
 namespace Ultima {
 namespace Ultima8 {
@@ -46,6 +47,21 @@ class ItemSorter {
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
 
+	// Screenspace grid over the clip window. Each cell lists the items
+	// whose shape rect touches it, so a new item is only compared against
+	// items it could overlap.
+	Std::vector<Std::vector<SortItem *> > _cells;
+	int32       _cellCols, _cellRows;
+	uint32      _cellStamp;
+	Std::vector<SortItem *> _candidates;
+
+	// First item of each distinct listLessThan() key in list order,
+	// used to find the insert point without walking the list
+	Std::vector<SortItem *> _keyHeads;
+
+	uint32      _itemCount;
+	uint32      _comparisons;
+
 public:
 	ItemSorter(int capacity);
 	~ItemSorter();
@@ -69,8 +85,16 @@ public:
 
 	void IncSortLimit(int count);
 
+	// Items and pairwise overlap tests in the current display list
+	uint32 getItemCount() const { return _itemCount; }
+	uint32 getComparisonCount() const { return _comparisons; }
+
 private:
 	bool PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootpad, int gridlines);
+
+	void getCellRange(const Rect &r, int32 &left, int32 &top, int32 &right, int32 &bottom) const;
+	void insertItem(SortItem *si, SortItem *addpoint);
+	void renumberItems();
 };
 
 } // End of namespace Ultima8
@@ -40,6 +40,8 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+#define DIRTY_TILE_SIZE 64
+#define DIRTY_TILE_MAX_RECTS 8
 
 namespace Wintermute {
 
@@ -57,6 +59,7 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
 	_dirtyRect = nullptr;
+	_dirtyTilesW = _dirtyTilesH = 0;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -67,12 +70,7 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 BaseRenderOSystem::~BaseRenderOSystem() {
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
-	}
+	clearRenderQueue();
 
 	delete _dirtyRect;
 
@@ -87,6 +85,11 @@ bool BaseRenderOSystem::initRenderer(int width, int height, bool windowed) {
 	_renderRect.setWidth(_width);
 	_renderRect.setHeight(_height);
 
+	_dirtyTilesW = (_width + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+	_dirtyTilesH = (_height + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+	_dirtyTiles.clear();
+	_dirtyTiles.resize(_dirtyTilesW * _dirtyTilesH);
+
 	_realWidth = width;
 	_realHeight = height;
 
@@ -148,8 +151,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyRects();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -171,7 +173,7 @@ bool BaseRenderOSystem::flip() {
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
+				it = unqueueTicket(it);
 				delete ticket;
 			} else {
 				(*it)->_wantsDraw = false;
@@ -188,8 +190,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen(_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyRects();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -258,7 +259,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	if (_disableDirtyRects) {
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 		return;
 	}
@@ -270,22 +271,14 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
+		RenderQueueIterator it;
+		if (findReusableTicket(compare, it)) {
+			if (_disableDirtyRects) {
+				drawFromSurface(*it);
+			} else {
+				drawFromQueuedTicket(it);
 			}
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
@@ -293,11 +286,85 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		drawFromTicket(ticket);
 	} else {
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 	}
 }
 
+bool BaseRenderOSystem::findReusableTicket(const RenderTicket &compare, RenderQueueIterator &result) {
+	TicketHashIndex::iterator bucket = _ticketsByHash.find(compare.getHash());
+	if (bucket == _ticketsByHash.end()) {
+		return false;
+	}
+
+	// Tickets not yet drawn this frame are exactly those after _lastFrameIter,
+	// and their draw numbers preserve the order from last frame.
+	bool found = false;
+	uint32 bestDrawNum = 0;
+	for (TicketBucket::iterator i = bucket->_value.begin(); i != bucket->_value.end(); ++i) {
+		RenderTicket *ticket = **i;
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare && (!found || ticket->_drawNum < bestDrawNum)) {
+			result = *i;
+			bestDrawNum = ticket->_drawNum;
+			found = true;
+		}
+	}
+	return found;
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::queueTicket(const RenderQueueIterator &pos, RenderTicket *ticket) {
+	RenderQueueIterator it = _renderQueue.insert(pos, ticket);
+	_ticketsByHash[ticket->getHash()].push_back(it);
+	if (ticket->_owner) {
+		_ticketsByOwner[ticket->_owner].push_back(it);
+	}
+	return it;
+}
+
+static void removeFromBucket(Common::Array<BaseRenderOSystem::RenderQueueIterator> &bucket, const BaseRenderOSystem::RenderQueueIterator &it) {
+	for (uint i = 0; i < bucket.size(); i++) {
+		if (bucket[i] == it) {
+			bucket[i] = bucket.back();
+			bucket.pop_back();
+			return;
+		}
+	}
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::unqueueTicket(const RenderQueueIterator &it) {
+	RenderTicket *ticket = *it;
+
+	TicketHashIndex::iterator bucket = _ticketsByHash.find(ticket->getHash());
+	if (bucket != _ticketsByHash.end()) {
+		removeFromBucket(bucket->_value, it);
+		if (bucket->_value.empty()) {
+			_ticketsByHash.erase(bucket);
+		}
+	}
+	if (ticket->_owner) {
+		TicketOwnerIndex::iterator owned = _ticketsByOwner.find(ticket->_owner);
+		if (owned != _ticketsByOwner.end()) {
+			removeFromBucket(owned->_value, it);
+			if (owned->_value.empty()) {
+				_ticketsByOwner.erase(owned);
+			}
+		}
+	}
+
+	return _renderQueue.erase(it);
+}
+
+void BaseRenderOSystem::clearRenderQueue() {
+	RenderQueueIterator it = _renderQueue.begin();
+	while (it != _renderQueue.end()) {
+		RenderTicket *ticket = *it;
+		it = _renderQueue.erase(it);
+		delete ticket;
+	}
+	_ticketsByHash.clear();
+	_ticketsByOwner.clear();
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -305,11 +372,12 @@ void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
-	RenderQueueIterator it;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		if ((*it)->_owner == surf) {
-			invalidateTicket(*it);
-		}
+	TicketOwnerIndex::iterator owned = _ticketsByOwner.find(surf);
+	if (owned == _ticketsByOwner.end()) {
+		return;
+	}
+	for (TicketBucket::iterator it = owned->_value.begin(); it != owned->_value.end(); ++it) {
+		invalidateTicket(**it);
 	}
 }
 
@@ -320,13 +388,13 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	// In-order
 	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
 		_lastFrameIter--;
-		_renderQueue.push_back(renderTicket);
+		queueTicket(_renderQueue.end(), renderTicket);
 		++_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	} else {
 		// Before something
 		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
+		queueTicket(pos, renderTicket);
 		--_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	}
@@ -343,7 +411,7 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
-		_renderQueue.erase(ticket);
+		unqueueTicket(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
 	}
@@ -356,6 +424,69 @@ void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 		_dirtyRect->extend(rect);
 	}
 	_dirtyRect->clip(_renderRect);
+
+	Common::Rect clipped(rect);
+	clipped.clip(_renderRect);
+	if (clipped.isEmpty() || _dirtyTiles.empty()) {
+		return;
+	}
+	int tileLeft = clipped.left / DIRTY_TILE_SIZE;
+	int tileRight = (clipped.right - 1) / DIRTY_TILE_SIZE;
+	int tileTop = clipped.top / DIRTY_TILE_SIZE;
+	int tileBottom = (clipped.bottom - 1) / DIRTY_TILE_SIZE;
+	for (int y = tileTop; y <= tileBottom; y++) {
+		for (int x = tileLeft; x <= tileRight; x++) {
+			_dirtyTiles[y * _dirtyTilesW + x] = true;
+		}
+	}
+}
+
+void BaseRenderOSystem::clearDirtyRects() {
+	delete _dirtyRect;
+	_dirtyRect = nullptr;
+	for (uint i = 0; i < _dirtyTiles.size(); i++) {
+		_dirtyTiles[i] = false;
+	}
+}
+
+void BaseRenderOSystem::collectDirtyRects(Common::Array<Common::Rect> &rects) const {
+	// Join horizontal runs of dirty tiles, then stack runs covering
+	// the same columns on consecutive rows into a single rect.
+	for (int y = 0; y < _dirtyTilesH && rects.size() <= DIRTY_TILE_MAX_RECTS; y++) {
+		int x = 0;
+		while (x < _dirtyTilesW) {
+			if (!_dirtyTiles[y * _dirtyTilesW + x]) {
+				x++;
+				continue;
+			}
+			int start = x;
+			while (x < _dirtyTilesW && _dirtyTiles[y * _dirtyTilesW + x]) {
+				x++;
+			}
+			Common::Rect run(start * DIRTY_TILE_SIZE, y * DIRTY_TILE_SIZE, x * DIRTY_TILE_SIZE, (y + 1) * DIRTY_TILE_SIZE);
+
+			bool merged = false;
+			for (uint i = 0; i < rects.size(); i++) {
+				if (rects[i].left == run.left && rects[i].right == run.right && rects[i].bottom == run.top) {
+					rects[i].bottom = run.bottom;
+					merged = true;
+					break;
+				}
+			}
+			if (!merged) {
+				rects.push_back(run);
+			}
+		}
+	}
+
+	if (rects.empty() || rects.size() > DIRTY_TILE_MAX_RECTS) {
+		rects.clear();
+		rects.push_back(*_dirtyRect);
+		return;
+	}
+	for (uint i = 0; i < rects.size(); i++) {
+		rects[i].clip(*_dirtyRect);
+	}
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -368,59 +499,69 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_wantsDraw == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+			it = unqueueTicket(it);
 			delete ticket;
 		} else {
 			++it;
 		}
 	}
+	uint32 drawNum = 0;
 	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
 			ticket->_wantsDraw = false;
+			ticket->_drawNum = drawNum++;
 			++it;
 		}
 		return;
 	}
 
+	Common::Array<Common::Rect> dirtyRects;
+	collectDirtyRects(dirtyRects);
+
 	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	bool singleOpaque = (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true);
+	for (uint i = 0; i < dirtyRects.size(); i++) {
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (!singleOpaque || dirtyRects[i] != (*it)->_dstRect) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRects[i], _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
 	}
+	// The dirty rects don't overlap, so drawing every ticket into all of
+	// them in turn keeps the per-pixel order of the queue.
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		for (uint i = 0; i < dirtyRects.size(); i++) {
+			if (ticket->_dstRect.intersects(dirtyRects[i])) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRects[i]);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
 		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
 		ticket->_wantsDraw = false;
+		ticket->_drawNum = drawNum++;
+	}
+	for (uint i = 0; i < dirtyRects.size(); i++) {
+		const Common::Rect &rect = dirtyRects[i];
+		g_system->copyRectToScreen(_renderSurface->getBasePtr(rect.left, rect.top), _renderSurface->pitch, rect.left, rect.top, rect.width(), rect.height());
 	}
-	g_system->copyRectToScreen(_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -428,7 +569,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_isValid == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+			it = unqueueTicket(it);
 			delete ticket;
 		} else {
 			++it;
@@ -526,12 +667,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	BaseRenderer::endSaveLoad();
 
 	// Clear the scale-buffered tickets as we just loaded.
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
-	}
+	clearRenderQueue();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
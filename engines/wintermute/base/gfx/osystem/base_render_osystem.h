@@ -32,6 +32,9 @@
 
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 
 #include "graphics/managed_surface.h"
 #include "graphics/transform_struct.h"
@@ -54,6 +57,11 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * Tickets are additionally indexed by their hash and by their owning surface,
+ * so finding a reusable ticket or invalidating a surface does not require
+ * walking the entire queue. Dirty areas are accumulated on a coarse tile grid
+ * and redrawn as a handful of separate rects instead of one bounding rect.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accommodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -119,10 +127,37 @@ private:
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
+	/**
+	 * Forget all dirty areas.
+	 */
+	void clearDirtyRects();
+	/**
+	 * Merge the dirty tiles into rects, falling back to the bounding
+	 * dirty rect when they fragment into too many pieces.
+	 */
+	void collectDirtyRects(Common::Array<Common::Rect> &rects) const;
 	/**
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Insert a ticket into the queue before pos and into the lookup indices.
+	 */
+	RenderQueueIterator queueTicket(const RenderQueueIterator &pos, RenderTicket *ticket);
+	/**
+	 * Remove a ticket from the queue and the lookup indices.
+	 * @return iterator following the removed ticket
+	 */
+	RenderQueueIterator unqueueTicket(const RenderQueueIterator &it);
+	/**
+	 * Remove and delete every ticket.
+	 */
+	void clearRenderQueue();
+	/**
+	 * Find the earliest valid ticket not yet drawn this frame that
+	 * matches the given one.
+	 */
+	bool findReusableTicket(const RenderTicket &compare, RenderQueueIterator &result);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
@@ -130,6 +165,16 @@ private:
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
 
+	typedef Common::Array<RenderQueueIterator> TicketBucket;
+	typedef Common::HashMap<uint32, TicketBucket> TicketHashIndex;
+	typedef Common::HashMap<BaseSurfaceOSystem *, TicketBucket> TicketOwnerIndex;
+	TicketHashIndex _ticketsByHash;
+	TicketOwnerIndex _ticketsByOwner;
+
+	Common::Array<bool> _dirtyTiles;
+	int _dirtyTilesW;
+	int _dirtyTilesH;
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
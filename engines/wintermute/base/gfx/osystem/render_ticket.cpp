@@ -43,7 +43,10 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _dstRect(*dstRect),
 	        _isValid(true),
 	        _wantsDraw(true),
-	        _transform(transform) {
+	        _transform(transform),
+	        _drawNum(0) {
+	computeHash();
+
 	if (surf) {
 		assert(surf->format.bytesPerPixel == 4);
 
@@ -91,6 +94,19 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
+void RenderTicket::computeHash() {
+	uint32 hash = (uint32)(uintptr)_owner;
+	hash = hash * 31 + (uint32)((_srcRect.left << 16) ^ (uint16)_srcRect.top);
+	hash = hash * 31 + (uint32)((_srcRect.right << 16) ^ (uint16)_srcRect.bottom);
+	hash = hash * 31 + (uint32)((_dstRect.left << 16) ^ (uint16)_dstRect.top);
+	hash = hash * 31 + (uint32)((_dstRect.right << 16) ^ (uint16)_dstRect.bottom);
+	hash = hash * 31 + (uint32)_transform._angle;
+	hash = hash * 31 + (uint32)((_transform._zoom.x << 16) ^ (uint16)_transform._zoom.y);
+	hash = hash * 31 + _transform._rgbaMod;
+	hash = hash * 31 + (uint32)(_transform._flip | (_transform._blendMode << 8));
+	_hash = hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::ManagedSurface *_targetSurface) const {
 	if (!getSurface()) {
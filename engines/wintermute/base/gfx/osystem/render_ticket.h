@@ -51,7 +51,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _drawNum(0), _hash(0) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -67,11 +67,20 @@ public:
 	Graphics::TransformStruct _transform;
 
 	BaseSurfaceOSystem *_owner;
+	// Position in the queue at the end of the last drawn frame
+	uint32 _drawNum;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+	/**
+	 * Hash over everything operator== compares, used to find
+	 * reusable tickets without walking the whole render queue.
+	 */
+	uint32 getHash() const { return _hash; }
 private:
+	void computeHash();
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
+	uint32 _hash;
 };
 
 } // End of namespace Wintermute
@@ -258,8 +258,10 @@ bool PartEmitter::update() {
 bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 	int numLive = 0;
 
+	_forceStep.prepare(_forces, timerDelta);
+
 	for (uint32 i = 0; i < _particles.size(); i++) {
-		_particles[i]->update(this, currentTime, timerDelta);
+		_particles[i]->update(this, currentTime, _forceStep);
 
 		if (!_particles[i]->_isDead) {
 			numLive++;
@@ -279,18 +281,17 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 			}
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
+			// revived particles stay alive, so the search for dead ones
+			// can continue where the previous one stopped
+			uint32 deadSearch = 0;
 			while (toGen > 0) {
-				int firstDeadIndex = -1;
-				for (uint32 i = 0; i < _particles.size(); i++) {
-					if (_particles[i]->_isDead) {
-						firstDeadIndex = i;
-						break;
-					}
+				while (deadSearch < _particles.size() && !_particles[deadSearch]->_isDead) {
+					deadSearch++;
 				}
 
 				PartParticle *particle;
-				if (firstDeadIndex >= 0) {
-					particle = _particles[firstDeadIndex];
+				if (deadSearch < _particles.size()) {
+					particle = _particles[deadSearch];
 				} else {
 					particle = new PartParticle(_gameRef);
 					_particles.add(particle);
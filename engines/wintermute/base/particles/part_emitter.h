@@ -131,6 +131,7 @@ private:
 	bool updateInternal(uint32 currentTime, uint32 timerDelta);
 	uint32 _lastGenTime;
 	BaseArray<PartParticle *> _particles;
+	PartForceStep _forceStep;
 	BaseArray<char *> _sprites;
 };
 
@@ -44,6 +44,34 @@ PartForce::~PartForce() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void PartForceStep::prepare(const BaseArray<PartForce *> &forces, uint32 timerDelta) {
+	_elapsedTime = (float)timerDelta / 1000.f;
+	_globalVelocity = Vector2(0.0f, 0.0f);
+	_pointForces.clear();
+
+	for (uint32 i = 0; i < forces.size(); i++) {
+		const PartForce *force = forces[i];
+		switch (force->_type) {
+		case PartForce::FORCE_GLOBAL:
+			_globalVelocity += force->_direction * _elapsedTime;
+			break;
+
+		case PartForce::FORCE_POINT: {
+			PointForce pointForce;
+			pointForce._pos = force->_pos;
+			pointForce._direction = force->_direction * _elapsedTime;
+			_pointForces.push_back(pointForce);
+		}
+		break;
+
+		default:
+			break;
+		}
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool PartForce::persist(BasePersistenceManager *persistMgr) {
 	if (persistMgr->getIsSaving()) {
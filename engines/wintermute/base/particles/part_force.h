@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/base.h"
 #include "engines/wintermute/base/base_named_object.h"
 #include "engines/wintermute/math/vector2.h"
+#include "engines/wintermute/coll_templ.h"
 
 namespace Wintermute {
 
@@ -51,6 +52,23 @@ public:
 	bool persist(BasePersistenceManager *PersistMgr) override;
 };
 
+/**
+ * The forces of an emitter evaluated once per update step, so particles
+ * don't have to walk and dispatch on the force list individually.
+ */
+struct PartForceStep {
+	struct PointForce {
+		Vector2 _pos;
+		Vector2 _direction; // premultiplied by the step time
+	};
+
+	float _elapsedTime;
+	Vector2 _globalVelocity; // sum of the global forces over the step
+	Common::Array<PointForce> _pointForces;
+
+	void prepare(const BaseArray<PartForce *> &forces, uint32 timerDelta);
+};
+
 } // End of namespace Wintermute
 
 #endif
@@ -92,7 +92,7 @@ bool PartParticle::setSprite(const Common::String &filename) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool PartParticle::update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta) {
+bool PartParticle::update(PartEmitter *emitter, uint32 currentTime, const PartForceStep &forces) {
 	if (_state == PARTICLE_FADEIN) {
 		if (currentTime - _fadeStart >= (uint32)_fadeTime) {
 			_state = PARTICLE_NORMAL;
@@ -145,28 +145,17 @@ bool PartParticle::update(PartEmitter *emitter, uint32 currentTime, uint32 timer
 		}
 
 		// update position
-		float elapsedTime = (float)timerDelta / 1000.f;
+		float elapsedTime = forces._elapsedTime;
 
-		for (uint32 i = 0; i < emitter->_forces.size(); i++) {
-			PartForce *force = emitter->_forces[i];
-			switch (force->_type) {
-			case PartForce::FORCE_GLOBAL:
-				_velocity += force->_direction * elapsedTime;
-				break;
+		_velocity += forces._globalVelocity;
+		for (uint32 i = 0; i < forces._pointForces.size(); i++) {
+			const PartForceStep::PointForce &force = forces._pointForces[i];
+			Vector2 vecDist = force._pos - _pos;
+			float dist = fabs(vecDist.length());
 
-			case PartForce::FORCE_POINT: {
-				Vector2 vecDist = force->_pos - _pos;
-				float dist = fabs(vecDist.length());
+			dist = 100.0f / dist;
 
-				dist = 100.0f / dist;
-
-				_velocity += force->_direction * dist * elapsedTime;
-			}
-			break;
-
-			default:
-				break;
-			}
+			_velocity += force._direction * dist;
 		}
 		_pos += _velocity * elapsedTime;
 
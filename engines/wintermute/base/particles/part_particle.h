@@ -36,6 +36,7 @@
 namespace Wintermute {
 
 class PartEmitter;
+struct PartForceStep;
 class BaseSprite;
 class BasePersistenceManager;
 
@@ -68,7 +69,7 @@ public:
 	bool _isDead;
 	TParticleState _state;
 
-	bool update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta);
+	bool update(PartEmitter *emitter, uint32 currentTime, const PartForceStep &forces);
 	bool display(PartEmitter *emitter);
 
 	bool setSprite(const Common::String &filename);
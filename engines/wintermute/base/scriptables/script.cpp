@@ -57,6 +57,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_symbolSlots = nullptr;
 
 	_engine = engine;
 
@@ -188,6 +189,10 @@ bool ScScript::initTables() {
 		_symbols[index] = getString();
 	}
 
+	delete[] _symbolSlots;
+	_symbolSlots = new TSymbolSlot[_numSymbols];
+	resetVarCaches();
+
 	// load functions table
 	_iP = _header.funcTable;
 
@@ -397,6 +402,9 @@ void ScScript::cleanup() {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	delete[] _symbolSlots;
+	_symbolSlots = nullptr;
+
 	if (_globals && !_thread) {
 		delete _globals;
 	}
@@ -543,6 +551,7 @@ bool ScScript::executeInstruction() {
 	ScValue *op1;
 	ScValue *op2;
 
+	uint32 instIP = _iP;
 	uint32 inst = getDWORD();
 
 #ifdef ENABLE_FOXTAIL
@@ -730,7 +739,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		// Disabled in original code
 		/*if (false && var->_type==VAL_OBJECT || var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
@@ -742,15 +751,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getSymbolVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -801,7 +809,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getSymbolVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -811,7 +819,7 @@ bool ScScript::executeInstruction() {
 
 	case II_PUSH_BY_EXP: {
 		str = _stack->pop()->getString();
-		ScValue *val = _stack->pop()->getProp(str);
+		ScValue *val = getCachedProp(instIP, _stack->pop(), str);
 		if (val) {
 			_stack->push(val);
 		} else {
@@ -1159,29 +1167,32 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+static ScValue *lookupVar(ScValue *table, const char *name) {
+	if (table->hasPlainProps()) {
+		return table->findProp(name);
+	}
+	return table->propExists(name) ? table->getProp(name) : nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
 	ScValue *ret = nullptr;
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = lookupVar(_scopeStack->getTop(), name);
 	}
 
 	// script globals
 	if (ret == nullptr) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = lookupVar(_globals, name);
 	}
 
 	// engine globals
 	if (ret == nullptr) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = lookupVar(_engine->_globals, name);
 	}
 
 	if (ret == nullptr) {
@@ -1203,6 +1214,73 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getSymbolVar(uint32 symbol) {
+	ScValue *scope = _scopeStack->_sP >= 0 ? _scopeStack->getTop() : nullptr;
+	ScValue *engineGlobals = _engine->_globals;
+
+	// the tables getVar() searches can only change the result by gaining
+	// or losing properties, which bumps their version stamps
+	if (!scope || scope->hasPlainProps()) {
+		if (_globals->hasPlainProps() && engineGlobals->hasPlainProps()) {
+			uint32 scopeVersion = scope ? scope->_propsVersion : 0;
+			TSymbolSlot &slot = _symbolSlots[symbol];
+			if (slot.value && slot.scope == scope && slot.scopeVersion == scopeVersion &&
+				slot.globalsVersion == _globals->_propsVersion && slot.engineGlobalsVersion == engineGlobals->_propsVersion) {
+				return slot.value;
+			}
+
+			ScValue *ret = getVar(_symbols[symbol]);
+
+			// getVar() may have declared the variable; record the versions after it
+			slot.value = ret;
+			slot.scope = scope;
+			slot.scopeVersion = scope ? scope->_propsVersion : 0;
+			slot.globalsVersion = _globals->_propsVersion;
+			slot.engineGlobalsVersion = engineGlobals->_propsVersion;
+			return ret;
+		}
+	}
+
+	return getVar(_symbols[symbol]);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getCachedProp(uint32 iP, ScValue *owner, const char *name) {
+	if (!owner->hasPlainProps()) {
+		return owner->getProp(name);
+	}
+
+	TPropCacheEntry &entry = _propCache[(iP >> 2) % SCRIPT_PROP_CACHE_SIZE];
+	if (entry.iP == iP && entry.owner == owner && entry.ownerVersion == owner->_propsVersion && entry.name == name) {
+		return entry.value;
+	}
+
+	ScValue *ret = owner->findProp(name);
+	if (ret) {
+		entry.iP = iP;
+		entry.owner = owner;
+		entry.ownerVersion = owner->_propsVersion;
+		entry.name = name;
+		entry.value = ret;
+	}
+	return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScScript::resetVarCaches() {
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_symbolSlots[i].value = nullptr;
+	}
+	for (int i = 0; i < SCRIPT_PROP_CACHE_SIZE; i++) {
+		_propCache[i].owner = nullptr;
+		_propCache[i].value = nullptr;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
@@ -1298,6 +1376,7 @@ bool ScScript::persist(BasePersistenceManager *persistMgr) {
 		}
 	} else {
 		persistMgr->transferUint32(TMEMBER(_bufferSize));
+		_symbolSlots = nullptr;
 		if (_bufferSize > 0) {
 			_buffer = new byte[_bufferSize];
 			persistMgr->getBytes(_buffer, _bufferSize);
@@ -41,6 +41,8 @@ class ScEngine;
 class ScStack;
 class ScValue;
 
+#define SCRIPT_PROP_CACHE_SIZE 32
+
 class ScScript : public BaseClass {
 public:
 	BaseArray<int> _breakpoints;
@@ -79,6 +81,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getSymbolVar(uint32 symbol);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -152,6 +155,30 @@ public:
 private:
 	char **_symbols;
 	uint32 _numSymbols;
+
+	// Resolved variable slot for each symbol, valid while none of the
+	// tables searched by getVar() had properties added or removed
+	typedef struct {
+		ScValue *value;
+		ScValue *scope;
+		uint32 scopeVersion;
+		uint32 globalsVersion;
+		uint32 engineGlobalsVersion;
+	} TSymbolSlot;
+	TSymbolSlot *_symbolSlots;
+
+	// Inline cache for II_PUSH_BY_EXP, indexed by instruction position
+	typedef struct {
+		uint32 iP;
+		ScValue *owner;
+		uint32 ownerVersion;
+		Common::String name;
+		ScValue *value;
+	} TPropCacheEntry;
+	TPropCacheEntry _propCache[SCRIPT_PROP_CACHE_SIZE];
+
+	ScValue *getCachedProp(uint32 iP, ScValue *owner, const char *name);
+	void resetVarCaches();
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
 	TEventPos *_events;
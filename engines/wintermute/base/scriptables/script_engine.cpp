@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "common/profiler.h"
 
 namespace Wintermute {
 
@@ -275,6 +276,8 @@ bool ScEngine::tick() {
 		return STATUS_OK;
 	}
 
+	PROFILE_SCOPE("ScEngine::tick");
+
 
 	// resolve waiting scripts
 	for (uint32 i = 0; i < _scripts.size(); i++) {
@@ -41,6 +41,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propsVersionCounter = 0;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -53,6 +55,7 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -68,6 +71,7 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -83,6 +87,7 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -98,6 +103,7 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -114,6 +120,7 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -156,6 +163,33 @@ ScValue::~ScValue() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScValue::touchProps() {
+	_propsVersion = ++_propsVersionCounter;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::hasPlainProps() const {
+	// natives, references and string lengths resolve outside _valObject
+	return _type != VAL_NATIVE && _type != VAL_VARIABLE_REF && _type != VAL_STRING;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const char *name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScValue::getProp(const char *name) {
 	if (_type == VAL_VARIABLE_REF) {
@@ -200,6 +234,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		touchProps();
 	}
 
 	return STATUS_OK;
@@ -227,13 +262,14 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			_valObject[name] = newVal;
+			touchProps();
 		} else {
 			newVal->cleanup();
 		}
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -277,6 +313,7 @@ void ScValue::deleteProps() {
 		_valIter++;
 	}
 	_valObject.clear();
+	touchProps();
 }
 
 
@@ -745,6 +782,7 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	} else {
 		_valObject.clear();
 	}
+	touchProps();
 }
 
 
@@ -817,6 +855,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 			_valObject[str] = val;
 			delete[] str;
 		}
+		touchProps();
 	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_valRef));
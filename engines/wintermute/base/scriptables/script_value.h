@@ -82,9 +82,13 @@ public:
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	ScValue *findProp(const char *name);
+	bool hasPlainProps() const;
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
+	static uint32 _propsVersionCounter;
+	void touchProps();
 	bool _valBool;
 	int32 _valInt;
 	double _valFloat;
@@ -100,6 +104,10 @@ public:
 	Common::HashMap<Common::String, ScValue *> _valObject;
 	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
 
+	// Stamp taken from a global counter whenever a property is added,
+	// removed or replaced, so callers may cache lookups by (value, version)
+	uint32 _propsVersion;
+
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
 	bool setProperty(const char *propName, double value);
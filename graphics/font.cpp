@@ -105,6 +105,32 @@ int getStringWidthImpl(const Font &font, const StringType &str) {
 	return space;
 }
 
+template<class StringType>
+bool drawRunImpl(const Font &font, Surface *dst, const StringType &str, int x, int y, int leftX, int rightX, uint32 color, bool alpha) {
+	Common::Rect drawn;
+	return font.drawRun(dst, str, x, y, leftX, rightX, color, nullptr, alpha, drawn);
+}
+
+template<class StringType>
+bool drawRunImpl(const Font &font, ManagedSurface *dst, const StringType &str, int x, int y, int leftX, int rightX, uint32 color, bool alpha) {
+	// Like drawChar, only blend with the transparent color when not storing the alpha channel
+	uint32 transColor = 0;
+	const uint32 *transparentColor = nullptr;
+	if (!alpha && dst->hasTransparentColor()) {
+		transColor = dst->getTransparentColor();
+		transparentColor = &transColor;
+	}
+
+	Common::Rect drawn;
+	if (!font.drawRun(dst->surfacePtr(), str, x, y, leftX, rightX, color, transparentColor, alpha, drawn))
+		return false;
+
+	// A single dirty rect for the whole run, instead of one per character
+	if (!drawn.isEmpty())
+		dst->addDirtyRect(drawn);
+	return true;
+}
+
 template<class SurfaceType, class StringType>
 void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, int x, int y, int w, uint32 color, TextAlign align, int deltax, bool alpha) {
 	// The logic in getBoundingImpl is the same as we use here. In case we
@@ -120,6 +146,9 @@ void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, i
 		x = x + w - width;
 	x += deltax;
 
+	if (drawRunImpl(font, dst, str, x, y, leftX, rightX, color, alpha))
+		return;
+
 	typename StringType::unsigned_type last = 0;
 	for (typename StringType::const_iterator i = str.begin(), end = str.end(); i != end; ++i) {
 		const typename StringType::unsigned_type cur = *i;
@@ -458,13 +487,31 @@ Common::Rect Font::getBoundingBox(const Common::U32String &input, int x, int y,
 }
 
 int Font::getStringWidth(const Common::String &str) const {
-	return getStringWidthImpl(*this, str);
+	return measureString(str);
 }
 
 int Font::getStringWidth(const Common::U32String &str) const {
+	return measureString(str);
+}
+
+int Font::measureString(const Common::String &str) const {
+	return getStringWidthImpl(*this, str);
+}
+
+int Font::measureString(const Common::U32String &str) const {
 	return getStringWidthImpl(*this, str);
 }
 
+bool Font::drawRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color,
+                   const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const {
+	return false;
+}
+
+bool Font::drawRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color,
+                   const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const {
+	return false;
+}
+
 void Font::drawChar(ManagedSurface *dst, uint32 chr, int x, int y, uint32 color) const {
 	drawChar(dst->surfacePtr(), chr, x, y, color);
 
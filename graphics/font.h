@@ -305,6 +305,39 @@ public:
 	/** @overload */
 	int getStringWidth(const Common::U32String &str) const;
 
+	/**
+	 * Compute the width of a string, as returned by getStringWidth.
+	 *
+	 * The default implementation adds up the widths and kerning offsets of
+	 * the characters. Fonts may override it, e.g. to cache the result.
+	 */
+	virtual int measureString(const Common::String &str) const;
+	/** @overload */
+	virtual int measureString(const Common::U32String &str) const;
+
+	/**
+	 * Draw a single line of text, once its position has been computed by
+	 * drawString or drawAlphaString.
+	 *
+	 * The characters are drawn from @p x on, skipping the ones ending left of
+	 * @p leftX and stopping at the first one ending right of @p rightX.
+	 *
+	 * Fonts which can render a whole run of characters faster than one at a
+	 * time may implement this. The default implementation returns false, in
+	 * which case the characters are drawn with drawChar or drawAlphaChar.
+	 *
+	 * @param transparentColor  Color to be considered transparent when blending, can be nullptr.
+	 * @param alpha             Whether to store the alpha channel, as drawAlphaChar does.
+	 * @param drawn             Set to the area covered by the drawn characters.
+	 *
+	 * @return true if the string was drawn.
+	 */
+	virtual bool drawRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color,
+	                     const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const;
+	/** @overload */
+	virtual bool drawRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color,
+	                     const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const;
+
 	/**
 	 * Word-wrap a text (that can contain newline characters) so that
 	 * no text line is wider than @p maxWidth pixels.
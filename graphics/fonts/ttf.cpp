@@ -38,6 +38,7 @@
 #include "common/stream.h"
 #include "common/memstream.h"
 #include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/ptr.h"
 #include "common/compression/unzip.h"
 
@@ -182,6 +183,14 @@ public:
 	void drawAlphaChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const override;
 	void drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint32 color) const override;
 
+	int measureString(const Common::String &str) const override;
+	int measureString(const Common::U32String &str) const override;
+
+	bool drawRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color,
+	             const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const override;
+	bool drawRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color,
+	             const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const override;
+
 private:
 	bool _initialized;
 	FT_StreamRec_ _stream;
@@ -194,7 +203,7 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
-		Surface image;
+		Surface image; ///< Area of an atlas page
 		int xOffset, yOffset;
 		int advance;
 		FT_UInt slot;
@@ -206,6 +215,53 @@ private:
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
+	/**
+	 * Look up the glyph of a character, caching it if needed.
+	 *
+	 * @return The glyph, or nullptr if the font has none for the character.
+	 */
+	const Glyph *findGlyph(uint32 chr) const;
+	int getKerningOffset(const Glyph *left, const Glyph *right) const;
+
+	enum {
+		kGlyphTableSize = 256,
+		kAtlasPageSize = 256,
+		kMaxCachedRuns = 512
+	};
+
+	// Glyphs of the ISO-8859-1 characters, which are all loaded at once,
+	// so that the most common lookups do not go through the hash map
+	const Glyph *_glyphTable[kGlyphTableSize];
+
+	// The glyph bitmaps are packed in rows ("shelves") of large pages,
+	// rather than allocated one by one
+	mutable Common::Array<Surface *> _atlasPages;
+	mutable Surface *_atlasPage;
+	mutable int _atlasX, _atlasY, _atlasShelfHeight;
+	void allocateGlyphImage(Surface &image, int w, int h) const;
+
+	// Strings laid out by measureString and drawRun. Text is mostly drawn
+	// again and again, and measured several times for alignment and wrapping.
+	struct RunGlyph {
+		const Glyph *glyph; ///< nullptr if the font has no glyph for the character
+		int x;              ///< Position of the character from the start of the run
+	};
+
+	struct TextRun {
+		Common::Array<RunGlyph> glyphs;
+		int width;
+	};
+
+	typedef Common::HashMap<Common::String, TextRun> StringRunCache;
+	typedef Common::HashMap<Common::U32String, TextRun> U32StringRunCache;
+	mutable StringRunCache _stringRuns;
+	mutable U32StringRunCache _u32StringRuns;
+
+	template<class StringType, class RunCache>
+	const TextRun &getRun(const StringType &str, RunCache &cache) const;
+	void drawRunIntern(Surface *dst, const TextRun &run, int x, int y, int leftX, int rightX, uint32 color,
+	                   const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const;
+
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
 	int computePointSize(int size, TTFSizeMode sizeMode) const;
@@ -213,6 +269,8 @@ private:
 	int computePointSizeFromHeaders(int height) const;
 	void drawCharIntern(Surface *dst, uint32 chr, int x, int y, uint32 color,
 		const uint32 *transparentColor, bool alpha) const;
+	void drawGlyph(Surface *dst, const Glyph &glyph, int x, int y, uint32 color,
+		const uint32 *transparentColor, bool alpha) const;
 
 	FT_Int32 _loadFlags;
 	FT_Render_Mode _renderMode;
@@ -226,7 +284,8 @@ TTFFont::TTFFont()
 	: _initialized(false), _stream(), _face(), _ttfFile(0), _width(0), _height(0), _ascent(0),
 	  _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
 	  _hasKerning(false), _allowLateCaching(false), _fakeBold(false), _fakeItalic(false),
-	  _disposeAfterUse(DisposeAfterUse::NO) {
+	  _disposeAfterUse(DisposeAfterUse::NO), _atlasPage(nullptr), _atlasX(0), _atlasY(0), _atlasShelfHeight(0) {
+	memset(_glyphTable, 0, sizeof(_glyphTable));
 }
 
 TTFFont::~TTFFont() {
@@ -237,11 +296,13 @@ TTFFont::~TTFFont() {
 			delete _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
-
 		_initialized = false;
 	}
+
+	for (uint i = 0; i < _atlasPages.size(); ++i) {
+		_atlasPages[i]->free();
+		delete _atlasPages[i];
+	}
 }
 
 
@@ -395,6 +456,11 @@ bool TTFFont::load(Common::SeekableReadStream *ttfFile, DisposeAfterUse::Flag di
 		}
 	}
 
+	for (uint i = 0; i < kGlyphTableSize; ++i) {
+		GlyphCache::const_iterator glyphEntry = _glyphs.find(i);
+		_glyphTable[i] = (glyphEntry != _glyphs.end()) ? &glyphEntry->_value : nullptr;
+	}
+
 	if (_glyphs.size() == 0) {
 		g_ttf.closeFont(_face);
 
@@ -548,57 +614,32 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
-		return 0;
-	else
-		return glyphEntry->_value.advance;
+	const Glyph *glyph = findGlyph(chr);
+	return glyph ? glyph->advance : 0;
 }
 
 int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
-	assureCached(left);
-	assureCached(right);
-
-	FT_UInt leftGlyph, rightGlyph;
-	GlyphCache::const_iterator glyphEntry;
-
-	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
-		leftGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
-
-	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
-		rightGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
+	return getKerningOffset(findGlyph(left), findGlyph(right));
+}
 
-	if (!leftGlyph || !rightGlyph)
+int TTFFont::getKerningOffset(const Glyph *left, const Glyph *right) const {
+	if (!_hasKerning || !left || !right || !left->slot || !right->slot)
 		return 0;
 
 	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+	FT_Get_Kerning(_face, left->slot, right->slot, FT_KERNING_DEFAULT, &kerningVector);
 	return (kerningVector.x / 64);
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end()) {
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph)
 		return Common::Rect();
-	} else {
-		const int xOffset = glyphEntry->_value.xOffset;
-		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
-		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
-	}
+
+	return Common::Rect(glyph->xOffset, glyph->yOffset, glyph->xOffset + glyph->image.w, glyph->yOffset + glyph->image.h);
 }
 
 namespace {
@@ -703,13 +744,13 @@ void TTFFont::drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint3
 
 void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 color,
 		const uint32 *transparentColor, bool alpha) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
-		return;
-
-	const Glyph &glyph = glyphEntry->_value;
+	const Glyph *glyph = findGlyph(chr);
+	if (glyph)
+		drawGlyph(dst, *glyph, x, y, color, transparentColor, alpha);
+}
 
+void TTFFont::drawGlyph(Surface *dst, const Glyph &glyph, int x, int y, uint32 color,
+		const uint32 *transparentColor, bool alpha) const {
 	x += glyph.xOffset;
 	y += glyph.yOffset;
 
@@ -787,6 +828,119 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 	}
 }
 
+int TTFFont::measureString(const Common::String &str) const {
+	return getRun(str, _stringRuns).width;
+}
+
+int TTFFont::measureString(const Common::U32String &str) const {
+	return getRun(str, _u32StringRuns).width;
+}
+
+bool TTFFont::drawRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color,
+		const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const {
+	drawRunIntern(dst, getRun(str, _stringRuns), x, y, leftX, rightX, color, transparentColor, alpha, drawn);
+	return true;
+}
+
+bool TTFFont::drawRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color,
+		const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const {
+	drawRunIntern(dst, getRun(str, _u32StringRuns), x, y, leftX, rightX, color, transparentColor, alpha, drawn);
+	return true;
+}
+
+template<class StringType, class RunCache>
+const TTFFont::TextRun &TTFFont::getRun(const StringType &str, RunCache &cache) const {
+	typename RunCache::const_iterator runEntry = cache.find(str);
+	if (runEntry != cache.end())
+		return runEntry->_value;
+
+	// Keep it simple: start over once the cache is full
+	if (cache.size() >= kMaxCachedRuns)
+		cache.clear();
+
+	TextRun &run = cache[str];
+	run.glyphs.resize(str.size());
+	run.width = 0;
+
+	// Same computation as Font::getStringWidth
+	const Glyph *last = findGlyph(0);
+	for (uint i = 0; i < str.size(); ++i) {
+		const Glyph *cur = findGlyph((typename StringType::unsigned_type)str[i]);
+		run.width += getKerningOffset(last, cur);
+		run.glyphs[i].glyph = cur;
+		run.glyphs[i].x = run.width;
+		if (cur)
+			run.width += cur->advance;
+		last = cur;
+	}
+
+	return run;
+}
+
+void TTFFont::drawRunIntern(Surface *dst, const TextRun &run, int x, int y, int leftX, int rightX, uint32 color,
+		const uint32 *transparentColor, bool alpha, Common::Rect &drawn) const {
+	drawn = Common::Rect();
+
+	// This follows the logic of Font::drawString, with glyphs and kerning
+	// already resolved
+	for (uint i = 0; i < run.glyphs.size(); ++i) {
+		const Glyph *glyph = run.glyphs[i].glyph;
+		const int charX = x + run.glyphs[i].x;
+
+		// Characters without a glyph have an empty bounding box
+		const int charRight = charX + (glyph ? glyph->xOffset + glyph->image.w : 0);
+		if (charRight > rightX)
+			break;
+		if (charRight < leftX || !glyph)
+			continue;
+
+		drawGlyph(dst, *glyph, charX, y, color, transparentColor, alpha);
+
+		Common::Rect charBox(glyph->xOffset, glyph->yOffset, glyph->xOffset + glyph->image.w, glyph->yOffset + glyph->image.h);
+		charBox.translate(charX, y);
+		if (drawn.isEmpty())
+			drawn = charBox;
+		else
+			drawn.extend(charBox);
+	}
+}
+
+void TTFFont::allocateGlyphImage(Surface &image, int w, int h) const {
+	const PixelFormat format = PixelFormat::createFormatCLUT8();
+	if (w == 0 || h == 0) {
+		image.init(w, h, 0, nullptr, format);
+		return;
+	}
+
+	// Glyphs larger than a page get a page of their own
+	if (w > kAtlasPageSize || h > kAtlasPageSize) {
+		Surface *page = new Surface();
+		page->create(w, h, format);
+		_atlasPages.push_back(page);
+		image = page->getSubArea(Common::Rect(w, h));
+		return;
+	}
+
+	// Start a new shelf when the current one is full, and a new page when
+	// there is no room left for another shelf
+	if (_atlasX + w > kAtlasPageSize) {
+		_atlasY += _atlasShelfHeight;
+		_atlasX = 0;
+		_atlasShelfHeight = 0;
+	}
+
+	if (!_atlasPage || _atlasY + h > kAtlasPageSize) {
+		_atlasPage = new Surface();
+		_atlasPage->create(kAtlasPageSize, kAtlasPageSize, format);
+		_atlasPages.push_back(_atlasPage);
+		_atlasX = _atlasY = _atlasShelfHeight = 0;
+	}
+
+	image = _atlasPage->getSubArea(Common::Rect(_atlasX, _atlasY, _atlasX + w, _atlasY + h));
+	_atlasX += w;
+	_atlasShelfHeight = MAX(_atlasShelfHeight, h);
+}
+
 bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	FT_UInt slot = FT_Get_Char_Index(_face, chr);
 	if (!slot)
@@ -852,7 +1006,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	}
 
 
-	glyph.image.create(bitmap->width, bitmap->rows, PixelFormat::createFormatCLUT8());
+	if (bitmap->pixel_mode != FT_PIXEL_MODE_MONO && bitmap->pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
+		return false;
+	}
+
+	allocateGlyphImage(glyph.image, bitmap->width, bitmap->rows);
 
 	const uint8 *src = bitmap->buffer;
 	int srcPitch = bitmap->pitch;
@@ -867,6 +1026,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	case FT_PIXEL_MODE_MONO:
 		for (int y = 0; y < (int)bitmap->rows; ++y) {
 			const uint8 *curSrc = src;
+			uint8 *curDst = dst;
 			uint8 mask = 0;
 
 			for (int x = 0; x < (int)bitmap->width; ++x) {
@@ -874,12 +1034,13 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					*curDst = 255;
 
 				mask <<= 1;
-				++dst;
+				++curDst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
 		break;
@@ -893,9 +1054,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		break;
 
 	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
-		glyph.image.free();
-		return false;
+		break;
 	}
 
 #if FAKE_BOLD == 1
@@ -918,6 +1077,18 @@ void TTFFont::assureCached(uint32 chr) const {
 	}
 }
 
+const TTFFont::Glyph *TTFFont::findGlyph(uint32 chr) const {
+	// These were all tried when loading the font
+	if (chr < kGlyphTableSize)
+		return _glyphTable[chr];
+
+	assureCached(chr);
+	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
+	if (glyphEntry == _glyphs.end())
+		return nullptr;
+	return &glyphEntry->_value;
+}
+
 Font *loadTTFFont(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, int size, TTFSizeMode sizeMode, uint xdpi, uint ydpi, TTFRenderMode renderMode, const uint32 *mapping, bool stemDarkening) {
 	TTFFont *font = new TTFFont();
 
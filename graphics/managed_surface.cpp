@@ -24,6 +24,7 @@
 #include "graphics/palette.h"
 #include "graphics/transform_tools.h"
 #include "common/algorithm.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 #include "common/endian.h"
 
@@ -501,6 +502,8 @@ void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRe
 	if (destRect.isEmpty())
 		return;
 
+	PROFILE_SCOPE("ManagedSurface::blitFrom");
+
 	const int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
 	const int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
 
@@ -874,6 +877,8 @@ void ManagedSurface::transBlitFromInner(const Surface &src, const Common::Rect &
 	if (src.w == 0 || src.h == 0 || destRect.width() == 0 || destRect.height() == 0)
 		return;
 
+	PROFILE_SCOPE("ManagedSurface::transBlitFrom");
+
 	HANDLE_BLIT(1, 1, uint8,  uint8)
 	HANDLE_BLIT(1, 2, uint8,  uint16)
 	HANDLE_BLIT(1, 4, uint8,  uint32)
@@ -76,25 +76,20 @@ void Screen::makeAllDirty() {
 }
 
 void Screen::mergeDirtyRects() {
-	Common::List<Common::Rect>::iterator rOuter, rInner;
+	// Each copy to the screen costs about as much as copying this many pixels
+	const uint32 rectCost = 1024;
 
-	// Process the dirty rect list to find any rects to merge
-	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
+	if (_dirtyRects.size() < 2)
+		return;
 
-			if ((*rOuter).intersects(*rInner)) {
-				// These two rectangles overlap, so merge them
-				unionRectangle(*rOuter, *rOuter, *rInner);
+	_dirtyRegion.clear();
+	for (const Common::Rect &r : _dirtyRects)
+		_dirtyRegion.unite(r);
+	_dirtyRegion.simplify(rectCost);
 
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
-
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
-	}
+	_dirtyRects.clear();
+	for (const Common::Rect &r : _dirtyRegion)
+		_dirtyRects.push_back(r);
 }
 
 bool Screen::unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2) {
@@ -27,6 +27,7 @@
 #include "graphics/pixelformat.h"
 #include "common/list.h"
 #include "common/rect.h"
+#include "common/region.h"
 
 namespace Graphics {
 
@@ -51,9 +52,16 @@ protected:
 	 * List of affected areas of the screen
 	 */
 	Common::List<Common::Rect> _dirtyRects;
+
+	/**
+	 * Union of the dirty areas, kept to reuse its storage between updates
+	 */
+	Common::Region _dirtyRegion;
 protected:
 	/**
-	 * Merges together overlapping dirty areas of the screen
+	 * Replaces the dirty areas of the screen by non-overlapping rects covering
+	 * them, or by their bounds when copying fewer pixels is not worth the
+	 * additional rects
 	 */
 	void mergeDirtyRects();
 
@@ -19,6 +19,12 @@
  *
  */
 
+// getrusage() is used to report the peak memory usage of benchmarks
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#ifdef POSIX
+#include <sys/resource.h>
+#endif
 
 #include "gui/EventRecorder.h"
 
@@ -29,10 +35,16 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 }
 
 #include "common/debug-channels.h"
+#ifdef SDL_BACKEND
 #include "backends/timer/sdl/sdl-timer.h"
+#endif
 #include "backends/mixer/mixer.h"
+#include "common/algorithm.h"
 #include "common/config-manager.h"
+#include "common/file.h"
+#include "common/fs.h"
 #include "common/md5.h"
+#include "common/profiler.h"
 #include "gui/gui-manager.h"
 #include "gui/widget.h"
 #include "gui/onscreendialog.h"
@@ -57,6 +69,9 @@ EventRecorder::EventRecorder() {
 	_needRedraw = false;
 	_processingMillis = false;
 	_fastPlayback = false;
+	_benchmark = false;
+	_benchmarkStart = 0;
+	_lastFrameMicros = 0;
 	_lastTimeDate.tm_sec = 0;
 	_lastTimeDate.tm_min = 0;
 	_lastTimeDate.tm_hour = 0;
@@ -89,6 +104,9 @@ void EventRecorder::deinit() {
 		return;
 	}
 	setFileHeader();
+	if (_benchmark) {
+		writeBenchmarkReport();
+	}
 	_needRedraw = false;
 	_initialized = false;
 	_recordMode = kPassthrough;
@@ -231,6 +249,14 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 	}
 }
 
+void EventRecorder::processPlaybackEnd() {
+	// The backend may exit right away once the recording is over, so the
+	// benchmark report can't wait for deinit()
+	if (_benchmark) {
+		writeBenchmarkReport();
+	}
+}
+
 bool EventRecorder::processDelayMillis() {
 	return _fastPlayback;
 }
@@ -256,6 +282,13 @@ void EventRecorder::processScreenUpdate() {
 		break;
 	case kRecorderUpdate: // fallthrough
 	case kRecorderPlayback:
+		if (_benchmark) {
+			uint64 now = g_system->getMicros();
+			if (_lastFrameMicros != 0) {
+				_frameTimes.push_back((uint32)(now - _lastFrameMicros));
+			}
+			_lastFrameMicros = now;
+		}
 		// if the next event isn't a screen update, fast forward until we find one.
 		if (_nextEvent.recordedtype != Common::kRecorderEventTypeScreenUpdate) {
 			int numSkipped = 0;
@@ -380,7 +413,7 @@ Common::String EventRecorder::generateRecordFileName(const Common::String &targe
 }
 
 
-void EventRecorder::init(const Common::String &recordFileName, RecordMode mode) {
+void EventRecorder::init(const Common::String &recordFileName, RecordMode mode, bool benchmark) {
 	_fakeMixerManager = new NullMixerManager();
 	_fakeMixerManager->init();
 	_fakeMixerManager->suspendAudio();
@@ -389,6 +422,12 @@ void EventRecorder::init(const Common::String &recordFileName, RecordMode mode)
 	_lastScreenshotTime = 0;
 	_recordMode = mode;
 	_needcontinueGame = false;
+	_recordFileName = recordFileName;
+	_benchmark = benchmark && (mode == kRecorderPlayback);
+	_fastPlayback = _benchmark;
+	_benchmarkStart = g_system->getMicros();
+	_lastFrameMicros = 0;
+	_frameTimes.clear();
 	if (ConfMan.hasKey("disable_display")) {
 		DebugMan.enableDebugChannel("EventRec");
 		gDebugLevel = 1;
@@ -559,7 +598,11 @@ void EventRecorder::registerTimerManager(DefaultTimerManager *timerManager) {
 void EventRecorder::switchTimerManagers() {
 	delete _timerManager;
 	if (_recordMode == kPassthrough) {
+#ifdef SDL_BACKEND
 		_timerManager = new SdlTimerManager();
+#else
+		_timerManager = new DefaultTimerManager();
+#endif
 	} else {
 		_timerManager = new DefaultTimerManager();
 	}
@@ -699,6 +742,9 @@ Common::SaveFileManager *EventRecorder::getSaveManager(Common::SaveFileManager *
 }
 
 void EventRecorder::preDrawOverlayGui() {
+	if (_benchmark) {
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -716,6 +762,9 @@ void EventRecorder::preDrawOverlayGui() {
 }
 
 void EventRecorder::postDrawOverlayGui() {
+	if (_benchmark) {
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -756,10 +805,12 @@ void EventRecorder::setFileHeader() {
 	_recordFile->getHeader().name = _name;
 }
 
+#ifdef SDL_BACKEND
 SDL_Surface *EventRecorder::getSurface(int width, int height) {
 	// Create a RGB565 surface of the requested dimensions.
 	return SDL_CreateRGBSurface(SDL_SWSURFACE, width, height, 16, 0xF800, 0x07E0, 0x001F, 0x0000);
 }
+#endif
 
 bool EventRecorder::switchMode() {
 	const Plugin *plugin = PluginMan.findEnginePlugin(ConfMan.get("engineid"));
@@ -816,6 +867,72 @@ void EventRecorder::deleteTemporarySave() {
 	_temporarySlot = -1;
 }
 
+void EventRecorder::writeBenchmarkReport() {
+	// Only report once, whichever of the end of the recording or deinit() comes first
+	_benchmark = false;
+	_fastPlayback = false;
+
+	uint64 wallTime = g_system->getMicros() - _benchmarkStart;
+	uint32 frames = _frameTimes.size();
+	uint64 totalFrameTime = 0;
+	for (uint i = 0; i < frames; ++i) {
+		totalFrameTime += _frameTimes[i];
+	}
+	Common::sort(_frameTimes.begin(), _frameTimes.end());
+
+	// Nearest rank percentiles, in microseconds
+	uint32 percentiles[4] = { 0, 0, 0, 0 };
+	static const uint32 ranks[4] = { 50, 90, 95, 99 };
+	for (int i = 0; i < 4 && frames > 0; ++i) {
+		percentiles[i] = _frameTimes[(frames * ranks[i] + 99) / 100 - 1];
+	}
+
+	Common::String peakRSS = "null";
+#ifdef POSIX
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef MACOSX
+		// Reported in bytes instead of kilobytes
+		usage.ru_maxrss /= 1024;
+#endif
+		peakRSS = Common::String::format("%ld", (long)usage.ru_maxrss);
+	}
+#endif
+
+	Common::String report = Common::String::format(
+		"{\n"
+		"  \"target\": \"%s\",\n"
+		"  \"recording\": \"%s\",\n"
+		"  \"frames\": %u,\n"
+		"  \"wall_time_ms\": %u,\n"
+		"  \"frame_time_us\": { \"mean\": %u, \"p50\": %u, \"p90\": %u, \"p95\": %u, \"p99\": %u, \"max\": %u },\n"
+		"  \"peak_rss_kb\": %s,\n"
+		"  \"screen_checks\": %u,\n"
+		"  \"md5_mismatches\": %u\n"
+		"}\n",
+		Common::Profiler::escapeJSON(ConfMan.getActiveDomainName().c_str()).c_str(),
+		Common::Profiler::escapeJSON(_recordFileName.c_str()).c_str(), frames, (uint32)(wallTime / 1000),
+		frames ? (uint32)(totalFrameTime / frames) : 0, percentiles[0], percentiles[1], percentiles[2], percentiles[3],
+		frames ? _frameTimes[frames - 1] : 0, peakRSS.c_str(),
+		_playbackFile->getScreenChecksCount(), _playbackFile->getScreenMismatchesCount());
+	_frameTimes.clear();
+
+	Common::String reportFileName = ConfMan.get("benchmark_report");
+	if (reportFileName.empty()) {
+		g_system->logMessage(LogMessageType::kInfo, report.c_str());
+		return;
+	}
+
+	Common::DumpFile file;
+	Common::FSNode node(Common::Path(reportFileName, Common::Path::kNativeSeparator));
+	if (!file.open(node)) {
+		warning("Could not open benchmark report file '%s'", reportFileName.c_str());
+		return;
+	}
+	file.writeString(report);
+	file.finalize();
+}
+
 } // End of namespace GUI
 
 #endif // ENABLE_EVENTRECORDER
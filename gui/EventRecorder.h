@@ -38,7 +38,11 @@
 #include "backends/mixer/mixer.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#ifdef SDL_BACKEND
 #include "backends/timer/sdl/sdl-timer.h"
+#else
+#include "backends/timer/default/default-timer.h"
+#endif
 #include "common/config-manager.h"
 #include "common/recorderfile.h"
 #include "backends/saves/recorder/recorder-saves.h"
@@ -77,13 +81,20 @@ public:
 		kRecorderUpdate = 4			/**< kRecorderUpdate, playback existing recording and update all hashes */
 	};
 
-	void init(const Common::String &recordFileName, RecordMode mode);
+	/**
+	 * Start recording or playing back.
+	 *
+	 * @param benchmark  Play back as fast as possible without the control
+	 *                   panel, and report the frame times once done.
+	 */
+	void init(const Common::String &recordFileName, RecordMode mode, bool benchmark = false);
 	void deinit();
 	bool processDelayMillis();
 	uint32 getRandomSeed(const Common::String &name);
 	void processTimeAndDate(TimeDate &td, bool skipRecord);
 	void processMillis(uint32 &millis, bool skipRecord);
 	void processScreenUpdate();
+	void processPlaybackEnd();
 	void processGameDescription(const ADGameDescription *desc);
 	bool processAutosave();
 	Common::SeekableReadStream *processSaveStream(const Common::String & fileName);
@@ -177,7 +188,9 @@ public:
 	Common::String generateRecordFileName(const Common::String &target);
 
 	Common::SaveFileManager *getSaveManager(Common::SaveFileManager *realSaveManager);
+#ifdef SDL_BACKEND
 	SDL_Surface *getSurface(int width, int height);
+#endif
 	void RegisterEventSource();
 
 	/** Retrieve game screenshot and compute its checksum for comparison */
@@ -243,10 +256,15 @@ private:
 	void saveScreenShot();
 	void checkRecordedMD5();
 	void deleteTemporarySave();
+	void writeBenchmarkReport();
 	void updateFakeTimer(uint32 millis);
 	volatile RecordMode _recordMode;
 	Common::String _recordFileName;
 	bool _fastPlayback;
+	bool _benchmark;
+	uint64 _benchmarkStart;
+	uint64 _lastFrameMicros;
+	Common::Array<uint32> _frameTimes;
 	bool _needRedraw;
 	bool _processingMillis;
 };
@@ -0,0 +1,318 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "gui/ThemeCache.h"
+
+#include "common/algorithm.h"
+#include "common/archive.h"
+#include "common/config-manager.h"
+#include "common/endian.h"
+#include "common/file.h"
+#include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
+#include "common/textconsole.h"
+#include "graphics/managed_surface.h"
+
+namespace GUI {
+
+// Increase when the content of the cache changes, e.g. when the bitmaps
+// are decoded differently
+static const uint32 kThemeCacheVersion = 3;
+
+namespace {
+
+void writePixelFormat(Common::WriteStream &stream, const Graphics::PixelFormat &format) {
+	stream.writeByte(format.bytesPerPixel);
+	stream.writeByte(format.rLoss);
+	stream.writeByte(format.gLoss);
+	stream.writeByte(format.bLoss);
+	stream.writeByte(format.aLoss);
+	stream.writeByte(format.rShift);
+	stream.writeByte(format.gShift);
+	stream.writeByte(format.bShift);
+	stream.writeByte(format.aShift);
+}
+
+Graphics::PixelFormat readPixelFormat(Common::ReadStream &stream) {
+	Graphics::PixelFormat format;
+	format.bytesPerPixel = stream.readByte();
+	format.rLoss = stream.readByte();
+	format.gLoss = stream.readByte();
+	format.bLoss = stream.readByte();
+	format.aLoss = stream.readByte();
+	format.rShift = stream.readByte();
+	format.gShift = stream.readByte();
+	format.bShift = stream.readByte();
+	format.aShift = stream.readByte();
+	return format;
+}
+
+} // End of anonymous namespace
+
+ThemeCache::ThemeCache(const Common::String &themeId, Common::Archive &archive, float scaleFactor, const Graphics::PixelFormat &format)
+	: _scale((uint32)(scaleFactor * 1000.0f + 0.5f)), _format(format), _stream(nullptr), _dirty(false) {
+	Common::String id = themeId;
+	for (uint i = 0; i < id.size(); ++i) {
+		if (!Common::isAlnum(id[i]))
+			id.setChar('_', i);
+	}
+
+	// The cache files are kept in the icons path, with the grid thumbnails,
+	// rather than in the save path of the running game
+	const Common::Path iconsPath = ConfMan.getPath("iconspath");
+	if (!iconsPath.empty()) {
+		const Common::String fileName = Common::String::format("%s-%u-%s.cache", id.c_str(), _scale, format.toString().c_str());
+		_cachePath = iconsPath.join("themecache").join(fileName);
+	}
+
+	_hash = computeArchiveHash(archive);
+
+	if (!load())
+		clear();
+}
+
+ThemeCache::~ThemeCache() {
+	clear();
+}
+
+Common::String ThemeCache::computeArchiveHash(Common::Archive &archive) {
+	// Hash the sizes and checksums of the theme files, as recorded in zip
+	// archives, so that the files do not have to be read. Theme directories
+	// do not record checksums, so the contents of their files are hashed.
+	Common::ArchiveMemberList members;
+	archive.listMembers(members);
+	Common::sort(members.begin(), members.end(), Common::ArchiveMemberListComparator());
+
+	Common::String digests;
+	for (const Common::ArchiveMemberPtr &member : members) {
+		if (member->isDirectory())
+			continue;
+
+		const Common::Path path = member->getPathInArchive();
+		uint32 size, crc;
+		Common::String checksum;
+		if (archive.getMemberInfo(path, size, crc)) {
+			checksum = Common::String::format("%08x", crc);
+		} else {
+			Common::SeekableReadStream *stream = member->createReadStream();
+			if (!stream)
+				continue;
+
+			size = stream->size();
+			checksum = Common::computeStreamMD5AsString(*stream);
+			delete stream;
+		}
+
+		digests += Common::String::format("%s %u %s\n", path.toString('/').c_str(), size, checksum.c_str());
+	}
+
+	Common::MemoryReadStream digestsStream((const byte *)digests.c_str(), digests.size());
+	return Common::computeStreamMD5AsString(digestsStream);
+}
+
+Common::String ThemeCache::bitmapKey(const Common::String &filename, const Common::String &scalableFile, int width, int height) {
+	return Common::String::format("%s|%s|%d|%d", filename.c_str(), scalableFile.c_str(), width, height);
+}
+
+bool ThemeCache::load() {
+	if (_cachePath.empty())
+		return false;
+
+	Common::File *cacheFile = new Common::File();
+	if (!cacheFile->open(Common::FSNode(_cachePath))) {
+		delete cacheFile;
+		return false;
+	}
+	_stream = cacheFile;
+
+	if (_stream->readUint32BE() != MKTAG('T', 'H', 'M', 'C') || _stream->readUint32LE() != kThemeCacheVersion)
+		return false;
+
+	if (_stream->readString() != _hash)
+		return false;
+
+	const uint32 fileCount = _stream->readUint32LE();
+	for (uint32 i = 0; i < fileCount && !_stream->eos(); ++i) {
+		CompiledFile file;
+		file.name = _stream->readString();
+		file.data.resize(_stream->readUint32LE());
+		if (!file.data.empty())
+			_stream->read(file.data.data(), file.data.size());
+		_files.push_back(file);
+	}
+
+	// The pixels are only read when requested
+	const uint32 bitmapCount = _stream->readUint32LE();
+	for (uint32 i = 0; i < bitmapCount && !_stream->eos(); ++i) {
+		const Common::String key = _stream->readString();
+		Bitmap bitmap;
+		bitmap.format = readPixelFormat(*_stream);
+		bitmap.w = _stream->readSint16LE();
+		bitmap.h = _stream->readSint16LE();
+		bitmap.hasTransparentColor = _stream->readByte() != 0;
+		bitmap.transparentColor = _stream->readUint32LE();
+		bitmap.offset = _stream->pos();
+		_stream->skip(bitmap.w * bitmap.h * bitmap.format.bytesPerPixel);
+		_bitmaps[key] = bitmap;
+	}
+
+	return !_stream->err() && !_stream->eos();
+}
+
+void ThemeCache::clear() {
+	delete _stream;
+	_stream = nullptr;
+
+	for (BitmapMap::iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i)
+		free(i->_value.pixels);
+
+	_bitmaps.clear();
+	_files.clear();
+}
+
+void ThemeCache::discard() {
+	clear();
+	_dirty = true;
+}
+
+void ThemeCache::addCompiledFile(const Common::String &name, const byte *data, uint32 size) {
+	CompiledFile file;
+	file.name = name;
+	file.data.resize(size);
+	if (size)
+		memcpy(file.data.data(), data, size);
+	_files.push_back(file);
+	_dirty = true;
+}
+
+Graphics::ManagedSurface *ThemeCache::loadBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height) {
+	BitmapMap::const_iterator i = _bitmaps.find(bitmapKey(filename, scalableFile, width, height));
+	if (i == _bitmaps.end())
+		return nullptr;
+
+	const Bitmap &bitmap = i->_value;
+	Graphics::ManagedSurface *surf = new Graphics::ManagedSurface(bitmap.w, bitmap.h, bitmap.format);
+	const uint32 size = bitmap.w * bitmap.h * bitmap.format.bytesPerPixel;
+
+	if (bitmap.pixels) {
+		memcpy(surf->getPixels(), bitmap.pixels, size);
+	} else if (_stream) {
+		_stream->seek(bitmap.offset);
+		if (_stream->read(surf->getPixels(), size) != size) {
+			delete surf;
+			return nullptr;
+		}
+	}
+
+	if (bitmap.hasTransparentColor)
+		surf->setTransparentColor(bitmap.transparentColor);
+
+	return surf;
+}
+
+void ThemeCache::addBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height, const Graphics::ManagedSurface &surf) {
+	Bitmap &bitmap = _bitmaps[bitmapKey(filename, scalableFile, width, height)];
+	free(bitmap.pixels);
+
+	bitmap.format = surf.format;
+	bitmap.w = surf.w;
+	bitmap.h = surf.h;
+	bitmap.hasTransparentColor = surf.hasTransparentColor();
+	bitmap.transparentColor = bitmap.hasTransparentColor ? surf.getTransparentColor() : 0;
+	bitmap.offset = -1;
+
+	// Store the rows packed, the surface may be a scaled one with a wider pitch
+	const uint32 rowSize = surf.w * surf.format.bytesPerPixel;
+	bitmap.pixels = (byte *)malloc(MAX<uint32>(rowSize * surf.h, 1));
+	for (int y = 0; y < surf.h; ++y)
+		memcpy(bitmap.pixels + y * rowSize, surf.getBasePtr(0, y), rowSize);
+
+	_dirty = true;
+}
+
+void ThemeCache::save() {
+	if (!_dirty)
+		return;
+
+	if (_cachePath.empty())
+		return;
+
+	// The bitmaps still in the old file have to be read before overwriting it
+	for (BitmapMap::iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
+		Bitmap &bitmap = i->_value;
+		if (bitmap.pixels)
+			continue;
+
+		const uint32 size = bitmap.w * bitmap.h * bitmap.format.bytesPerPixel;
+		bitmap.pixels = (byte *)malloc(MAX<uint32>(size, 1));
+		_stream->seek(bitmap.offset);
+		if (_stream->read(bitmap.pixels, size) != size) {
+			warning("ThemeCache: Failed to read '%s'", _cachePath.toString(Common::Path::kNativeSeparator).c_str());
+			return;
+		}
+	}
+
+	delete _stream;
+	_stream = nullptr;
+
+	Common::DumpFile out;
+	if (!out.open(_cachePath, true)) {
+		warning("ThemeCache: Failed to create '%s'", _cachePath.toString(Common::Path::kNativeSeparator).c_str());
+		return;
+	}
+
+	out.writeUint32BE(MKTAG('T', 'H', 'M', 'C'));
+	out.writeUint32LE(kThemeCacheVersion);
+	out.writeString(_hash);
+	out.writeByte(0);
+
+	out.writeUint32LE(_files.size());
+	for (const CompiledFile &file : _files) {
+		out.writeString(file.name);
+		out.writeByte(0);
+		out.writeUint32LE(file.data.size());
+		if (!file.data.empty())
+			out.write(file.data.data(), file.data.size());
+	}
+
+	out.writeUint32LE(_bitmaps.size());
+	for (BitmapMap::const_iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
+		const Bitmap &bitmap = i->_value;
+		out.writeString(i->_key);
+		out.writeByte(0);
+		writePixelFormat(out, bitmap.format);
+		out.writeSint16LE(bitmap.w);
+		out.writeSint16LE(bitmap.h);
+		out.writeByte(bitmap.hasTransparentColor ? 1 : 0);
+		out.writeUint32LE(bitmap.transparentColor);
+		out.write(bitmap.pixels, bitmap.w * bitmap.h * bitmap.format.bytesPerPixel);
+	}
+
+	out.finalize();
+	if (out.err())
+		warning("ThemeCache: Failed to write '%s'", _cachePath.toString(Common::Path::kNativeSeparator).c_str());
+
+	out.close();
+	_dirty = false;
+}
+
+} // End of namespace GUI
@@ -0,0 +1,122 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GUI_THEME_CACHE_H
+#define GUI_THEME_CACHE_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/path.h"
+#include "common/str.h"
+#include "graphics/pixelformat.h"
+
+namespace Common {
+class Archive;
+class SeekableReadStream;
+}
+
+namespace Graphics {
+class ManagedSurface;
+}
+
+namespace GUI {
+
+/**
+ * Binary cache of a theme, which speeds up loading it.
+ *
+ * The cache stores the keys of the theme STX files, as recorded by the
+ * XML parser, and the bitmaps once decoded, rasterized and scaled. There
+ * is a cache file for each theme, scale factor and overlay pixel format,
+ * in the icons path. It is discarded whenever the sizes or the checksums
+ * of the theme files change.
+ */
+class ThemeCache {
+public:
+	ThemeCache(const Common::String &themeId, Common::Archive &archive, float scaleFactor, const Graphics::PixelFormat &format);
+	~ThemeCache();
+
+	/** A compiled STX file, see Common::XMLParser::parseCompiled() */
+	struct CompiledFile {
+		Common::String name;
+		Common::Array<byte> data;
+	};
+
+	/** Compiled STX files from the cache, in parsing order. Empty if they have to be parsed. */
+	const Common::Array<CompiledFile> &getCompiledFiles() const { return _files; }
+
+	/** Store a compiled STX file, when they could not be loaded from the cache. */
+	void addCompiledFile(const Common::String &name, const byte *data, uint32 size);
+
+	/**
+	 * Load a bitmap from the cache.
+	 *
+	 * The parameters are the ones of ThemeEngine::addBitmap().
+	 *
+	 * @return A new surface, or nullptr if the bitmap is not cached.
+	 */
+	Graphics::ManagedSurface *loadBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height);
+
+	/** Store a bitmap loaded by ThemeEngine::addBitmap(). */
+	void addBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height, const Graphics::ManagedSurface &surf);
+
+	/** Drop the content of the cache, so that it gets rebuilt. */
+	void discard();
+
+	/** Write the cache file back if anything was added to it. */
+	void save();
+
+private:
+	struct Bitmap {
+		Bitmap() : w(0), h(0), hasTransparentColor(false), transparentColor(0), offset(-1), pixels(nullptr) {}
+
+		Graphics::PixelFormat format;
+		int16 w, h;
+		bool hasTransparentColor;
+		uint32 transparentColor;
+
+		int64 offset; ///< Position of the pixels in the cache file, -1 for added bitmaps
+		byte *pixels; ///< Pixels of added bitmaps, or loaded back for saving
+	};
+
+	typedef Common::HashMap<Common::String, Bitmap> BitmapMap;
+
+	static Common::String computeArchiveHash(Common::Archive &archive);
+	static Common::String bitmapKey(const Common::String &filename, const Common::String &scalableFile, int width, int height);
+
+	bool load();
+	void clear();
+
+	Common::Path _cachePath; ///< Empty if there is no icons path to store the cache in
+	Common::String _hash;
+	uint32 _scale;
+	Graphics::PixelFormat _format;
+
+	Common::SeekableReadStream *_stream;
+	Common::Array<CompiledFile> _files;
+	BitmapMap _bitmaps;
+	bool _dirty;
+};
+
+} // End of namespace GUI
+
+#endif
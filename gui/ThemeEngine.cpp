@@ -23,6 +23,7 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/compression/unzip.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
@@ -42,6 +43,7 @@
 
 #include "gui/widget.h"
 #include "gui/ThemeEngine.h"
+#include "gui/ThemeCache.h"
 #include "gui/ThemeEval.h"
 #include "gui/ThemeParser.h"
 
@@ -186,7 +188,7 @@ static const DrawDataInfo kDrawDataDefaults[] = {
  * ThemeEngine class
  *********************************************************/
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
-	_system(nullptr), _vectorRenderer(nullptr),
+	_system(nullptr), _vectorRenderer(nullptr), _themeCache(nullptr),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(nullptr), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(nullptr), _scaleFactor(1.0f) {
@@ -652,14 +654,26 @@ bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String
 		return true;
 	}
 
+	if (_themeCache) {
+		surf = _themeCache->loadBitmap(filename, scalablefile, width, height);
+		if (surf) {
+			_bitmaps[filename] = surf;
+			return true;
+		}
+	}
+
 	if (!scalablefile.empty()) {
 		Common::ArchiveMemberList members;
 		_themeFiles.listMatchingMembers(members, Common::Path(scalablefile, '/'));
 		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
 			Common::SeekableReadStream *stream = (*i)->createReadStream();
 			if (stream) {
-				_bitmaps[filename] = new Graphics::SVGBitmap(stream, width * _scaleFactor, height * _scaleFactor);
+				surf = new Graphics::SVGBitmap(stream, width * _scaleFactor, height * _scaleFactor);
 				delete stream;
+
+				if (_themeCache)
+					_themeCache->addBitmap(filename, scalablefile, width, height, *surf);
+				_bitmaps[filename] = surf;
 				return true;
 			}
 		}
@@ -731,6 +745,9 @@ bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String
 
 		surf = surf2;
 	}
+	if (surf && _themeCache)
+		_themeCache->addBitmap(filename, scalablefile, width, height, *surf);
+
 	// Store the surface into our hashmap (attention, may store NULL entries!)
 	_bitmaps[filename] = surf;
 
@@ -880,6 +897,41 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		return false;
 	}
 
+	// The STX files and the bitmaps are loaded from the theme cache when
+	// it is up to date, and stored in it otherwise
+	ThemeCache cache(_themeId, *_themeArchive, _scaleFactor, _overlayFormat);
+	_themeCache = &cache;
+	const bool result = loadThemeSTX(themeId, cache);
+	_themeCache = nullptr;
+
+	if (result)
+		cache.save();
+
+	return result;
+}
+
+bool ThemeEngine::loadThemeSTX(const Common::String &themeId, ThemeCache &cache) {
+	if (!cache.getCompiledFiles().empty()) {
+		bool result = true;
+		for (const ThemeCache::CompiledFile &file : cache.getCompiledFiles()) {
+			_parser->loadStream(new Common::MemoryReadStream(file.data.data(), file.data.size()), file.name);
+			result = _parser->parseCompiled();
+			_parser->close();
+
+			if (!result)
+				break;
+		}
+
+		if (result)
+			return true;
+
+		// Start over from the theme files
+		warning("Invalid cache for theme '%s'", themeId.c_str());
+		_themeOk = true;
+		unloadTheme();
+		cache.discard();
+	}
+
 	Common::ArchiveMemberList members;
 	if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
 		warning("Found no STX files for theme '%s'.", themeId.c_str());
@@ -898,13 +950,19 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 			return false;
 		}
 
-		if (_parser->parse() == false) {
+		Common::MemoryWriteStreamDynamic compiled(DisposeAfterUse::YES);
+		_parser->setCompiledOutput(&compiled);
+		const bool parsed = _parser->parse();
+		_parser->setCompiledOutput(nullptr);
+
+		if (parsed == false) {
 			warning("Failed to parse STX file '%s'", member->getName().c_str());
 			_parser->close();
 			return false;
 		}
 
 		_parser->close();
+		cache.addCompiledFile(member->getName(), compiled.getData(), compiled.size());
 	}
 
 	assert(!_themeName.empty());
@@ -51,6 +51,7 @@ struct WidgetDrawData;
 struct TextDrawData;
 class Dialog;
 class GuiObject;
+class ThemeCache;
 class ThemeEval;
 class ThemeParser;
 
@@ -675,6 +676,12 @@ protected:
 	 */
 	bool loadThemeXML(const Common::String &themeId);
 
+	/**
+	 * Parses the STX files of the theme archive, or replays them from the
+	 * theme cache when available.
+	 */
+	bool loadThemeSTX(const Common::String &themeId, ThemeCache &cache);
+
 	/**
 	 * Loads the default theme file (the embedded XML file found
 	 * in ThemeDefaultXML.cpp).
@@ -756,6 +763,9 @@ protected:
 	/** Theme getEvaluator (changed from GUI::Eval to add functionality) */
 	GUI::ThemeEval *_themeEval;
 
+	/** Cache of the theme being loaded, nullptr otherwise */
+	GUI::ThemeCache *_themeCache;
+
 	/** Main screen surface. This is blitted straight into the overlay. */
 	Graphics::ManagedSurface _screen;
 
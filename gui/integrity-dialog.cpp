@@ -27,6 +27,7 @@
 #include "common/file.h"
 #include "common/macresman.h"
 #include "common/md5.h"
+#include "common/ptr.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
 
@@ -43,7 +44,6 @@ enum {
 	kResponseCmd = 'IDRC',
 	kCopyEmailCmd = 'IDCE',
 	kCleanupCmd = 'IDCl',
-	kDownloadProgressCmd = 'DLPg',
 };
 
 struct ResultFormat {
@@ -61,13 +61,68 @@ struct ResultFormat {
 
 } static *g_result;
 
+enum {
+	kChecksumLanes = 4,					///< Files hashed together, see Common::MD5::updateMulti()
+	kChecksumChunkSize = 256 * 1024,	///< Read size, which has to divide the 1 MB prefix size
+	kChecksumPrefixSize = 1024 * 1024,
+	kChecksumShortSize = 5000,
+	kChecksumTimeSlice = 50				///< Milliseconds spent hashing in each tickle
+};
+
+struct ChecksumFile {
+	Common::Path path;
+	bool macFile;
+	uint64 size;
+};
+
+struct ChecksumLane {
+	uint file;
+	Common::MacResManager *macFile;		///< Set while the forks of a Mac file are read
+	char fork;							///< 'd' or 'r' for the fork being read, 0 for plain files
+	Common::SeekableReadStream *stream;
+	Common::StringArray checksums;		///< Checksums of the file, taken so far
+	Common::MD5 md5;
+	Common::String shortPrefixMD5;
+	Common::String prefixMD5;
+	uint64 fileRead;
+	uint64 pos;
+	uint32 chunkSize;
+	Common::Array<byte> buffer;
+
+	ChecksumLane() : file(0), macFile(nullptr), fork(0), stream(nullptr), fileRead(0), pos(0), chunkSize(0) {}
+
+	void start(Common::SeekableReadStream *newStream, char newFork) {
+		stream = newStream;
+		fork = newFork;
+		md5.reset();
+		pos = 0;
+		buffer.resize(kChecksumChunkSize);
+	}
+
+	void clear() {
+		// The resource fork stream reads from the Mac file
+		delete stream;
+		stream = nullptr;
+		delete macFile;
+		macFile = nullptr;
+		checksums.clear();
+	}
+};
+
 struct ChecksumDialogState {
 	IntegrityDialog *dialog;
 	ProcessState state;
 
-	int totalSize;
-	int calculatedSize;
-	uint32 lastUpdate;
+	uint64 totalSize;
+	uint64 calculatedSize;
+
+	Common::Array<ChecksumFile> files;
+	Common::Array<Common::StringArray> fileChecksums; ///< By file, empty for the files which could not be read
+	uint nextFile;
+	uint filesDone;
+	ChecksumLane lanes[kChecksumLanes];
+	bool stopOnError;
+	bool searchPathAdded;
 
 	Common::String endpoint;
 	Common::Path gamePath;
@@ -80,9 +135,24 @@ struct ChecksumDialogState {
 	ChecksumDialogState() {
 		state = kChecksumStateNone;
 		totalSize = calculatedSize = 0;
-		lastUpdate = 0;
+		nextFile = filesDone = 0;
+		stopOnError = false;
+		searchPathAdded = false;
 		dialog = nullptr;
 	}
+
+	~ChecksumDialogState() {
+		for (ChecksumLane &lane : lanes)
+			lane.clear();
+
+		removeSearchPath();
+	}
+
+	void removeSearchPath() {
+		if (searchPathAdded)
+			SearchMan.remove(gamePath.toString());
+		searchPathAdded = false;
+	}
 } static *g_checksum_state;
 
 uint32 getCalculationProgress() {
@@ -94,7 +164,7 @@ uint32 getCalculationProgress() {
 	return progress;
 }
 
-IntegrityDialog::IntegrityDialog(Common::String endpoint, Common::String domain) : Dialog("GameOptions_IntegrityDialog"), CommandSender(this), _close(false), _lastEventPoll(0) {
+IntegrityDialog::IntegrityDialog(Common::String endpoint, Common::String domain) : Dialog("GameOptions_IntegrityDialog"), CommandSender(this), _close(false) {
 
 	_backgroundType = GUI::ThemeEngine::kDialogBackgroundPlain;
 
@@ -136,7 +206,14 @@ IntegrityDialog::IntegrityDialog(Common::String endpoint, Common::String domain)
 		g_checksum_state->extra = ConfMan.get("extra", domain);
 		g_checksum_state->platform = ConfMan.get("platform", domain);
 		g_checksum_state->language = ConfMan.get("language", domain);
-		calculateTotalSize(g_checksum_state->gamePath);
+		g_checksum_state->stopOnError = ConfMan.getBool("integrity_stop_on_error");
+
+		// Add game path to SearchMan
+		SearchMan.addDirectory(g_checksum_state->gamePath.toString(), g_checksum_state->gamePath, 0, 20);
+		g_checksum_state->searchPathAdded = true;
+
+		collectFiles(g_checksum_state->gamePath, g_checksum_state->gamePath);
+		g_checksum_state->fileChecksums.resize(g_checksum_state->files.size());
 	} else {
 		g_checksum_state->dialog = this;
 
@@ -149,35 +226,6 @@ IntegrityDialog::~IntegrityDialog() {
 }
 
 
-bool IntegrityDialog::progressUpdate(int bytesProcessed) {
-	if (g_checksum_state->dialog->_close)
-		return false;
-
-	g_checksum_state->calculatedSize += bytesProcessed;
-
-	if (g_system->getMillis() > g_checksum_state->lastUpdate + 500) {
-		g_checksum_state->lastUpdate = g_system->getMillis();
-		g_checksum_state->dialog->sendCommand(kDownloadProgressCmd, 0);
-	}
-
-	Common::Event event;
-	if (g_system->getEventManager()->pollEvent(event)) {
-		if (g_system->getMillis() > g_checksum_state->dialog->_lastEventPoll + 16) {
-			g_checksum_state->dialog->_lastEventPoll = g_system->getMillis();
-			g_gui.processEvent(event, g_checksum_state->dialog);
-			g_system->updateScreen();
-		}
-	}
-
-	return true;
-};
-
-static bool progressUpdateCallback(void *param, int bytesProcessed) {
-	IntegrityDialog *dialog = (IntegrityDialog *)param;
-	return dialog->progressUpdate(bytesProcessed);
-};
-
-
 void IntegrityDialog::open() {
 	Dialog::open();
 	reflowLayout();
@@ -225,6 +273,12 @@ void IntegrityDialog::setState(ProcessState state) {
 		_progressBar->setVisible(false);
 		break;
 
+	case kChecksumFailed:
+		_statusText->setLabel(Common::U32String::format(_("Verification stopped")));
+		_cancelButton->setLabel(_("Close"));
+		_cancelButton->setCmd(kCleanupCmd);
+		break;
+
 	case kResponseReceived:
 		if (g_result->messageText.size() != 0) {
 			_resultsText->setList(g_result->messageText);
@@ -251,12 +305,6 @@ void IntegrityDialog::handleCommand(CommandSender *sender, uint32 cmd, uint32 da
 		_close = true;
 		break;
 	}
-	case kDownloadProgressCmd:
-		if (!_close) {
-			refreshWidgets();
-			g_gui.redrawFull();
-		}
-		break;
 	case kCopyEmailCmd: {
 		g_system->openUrl(g_result->emailLink);
 		break;
@@ -273,11 +321,12 @@ void IntegrityDialog::handleTickle() {
 		return;
 	}
 
+	const uint filesDone = g_checksum_state->filesDone;
 	if (g_checksum_state->state == kChecksumStateCalculating)
-		sendJSON();
+		calculateChecksums();
 
 	int32 progress = getCalculationProgress();
-	if (_progressBar->getValue() != progress) {
+	if (_progressBar->getValue() != progress || g_checksum_state->filesDone != filesDone) {
 		refreshWidgets();
 		g_gui.scheduleTopDialogRedraw();
 	}
@@ -302,6 +351,10 @@ void IntegrityDialog::refreshWidgets() {
 	_percentLabel->setLabel(Common::String::format("%u %%", progress));
 	_calcSizeLabel->setLabel(getSizeLabelText());
 	_progressBar->setValue(progress);
+
+	if (g_checksum_state->state == kChecksumStateCalculating && !g_checksum_state->files.empty())
+		_statusText->setLabel(Common::U32String::format(_("Calculating file checksums... (%u / %u files)"),
+			g_checksum_state->filesDone, g_checksum_state->files.size()));
 }
 
 void IntegrityDialog::setError(Common::U32String &msg) {
@@ -311,8 +364,8 @@ void IntegrityDialog::setError(Common::U32String &msg) {
 	_cancelButton->setCmd(kCleanupCmd);
 }
 
-void IntegrityDialog::calculateTotalSize(Common::Path gamePath) {
-	const Common::FSNode dir(gamePath);
+void IntegrityDialog::collectFiles(const Common::Path &currentPath, const Common::Path &gamePath) {
+	const Common::FSNode dir(currentPath);
 
 	if (!dir.exists() || !dir.isDirectory())
 		return;
@@ -324,37 +377,9 @@ void IntegrityDialog::calculateTotalSize(Common::Path gamePath) {
 	if (fileList.empty())
 		return;
 
-	// Process the files and subdirectories in the current directory recursively
-	for (const auto &entry : fileList) {
-		if (entry.isDirectory())
-			calculateTotalSize(entry.getPath());
-		else {
-			Common::File file;
-			if (!file.open(entry))
-				continue;
-
-			g_checksum_state->totalSize += file.size();
-		}
-	}
-}
-
-Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath) {
-	const Common::FSNode dir(currentPath);
-
-	if (!dir.exists() || !dir.isDirectory())
-		return {};
-
-	Common::FSList fileList;
-	if (!dir.getChildren(fileList, Common::FSNode::kListAll))
-		return {};
-
-	if (fileList.empty())
-		return {};
-
 	// First, we go through the list and check any Mac files
 	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> macFiles;
 	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> toRemove;
-	Common::List<Common::Path> tmpFileList;
 
 	for (const auto &entry : fileList) {
 		if (entry.isDirectory())
@@ -386,11 +411,6 @@ Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Pa
 			default:
 				error("Unsupported MacResManager mode: %d", macFile.getMode());
 			}
-
-			tmpFileList.push_back(filename);
-		} else {
-			if (!toRemove.contains(originalFileName))
-				tmpFileList.push_back(originalFileName);
 		}
 	}
 
@@ -407,100 +427,211 @@ Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Pa
 			continue;
 
 		if (entry.isDirectory()) {
-			generateChecksums(entry.getPath(), fileChecksums, gamePath);
+			collectFiles(entry.getPath(), gamePath);
 
 			continue;
 		}
 
-		auto macFile = Common::MacResManager();
+		ChecksumFile file;
+		file.path = filename;
+		file.size = 0;
 
-		if (macFile.open(filename) && macFile.isMacFile()) {
-			auto dataForkStream = macFile.openFileOrDataFork(filename);
+		auto macFile = Common::MacResManager();
 
-			Common::Array<Common::String> fileChecksum = {filename.toString()};
+		file.macFile = macFile.open(filename) && macFile.isMacFile();
+		if (file.macFile) {
+			file.size = macFile.getDataForkSize() + macFile.getResForkSize();
+		} else {
+			// Files which cannot be opened are still listed, so that they are reported
+			Common::File plainFile;
+			if (plainFile.open(filename))
+				file.size = plainFile.size();
+		}
 
-			// Data fork
-			// Various checksizes
-			for (auto size : {0, 5000, 1024 * 1024}) {
-				Common::String sz = size ? Common::String::format("-%d", size) : "";
-				fileChecksum.push_back(Common::String::format("md5-d%s", sz.c_str()));
-				fileChecksum.push_back(Common::computeStreamMD5AsString(*dataForkStream, size, progressUpdateCallback, this));
-				dataForkStream->seek(0);
-			}
-			// Tail checksums with checksize 5000
-			dataForkStream->seek(-5000, SEEK_END);
-			fileChecksum.push_back("md5-dt-5000");
-			fileChecksum.push_back(Common::computeStreamMD5AsString(*dataForkStream, 0, progressUpdateCallback, this).c_str());
-
-			// Resource fork
-			if (macFile.hasResFork()) {
-				// Various checksizes
-				for (auto size : {0, 5000, 1024 * 1024}) {
-					Common::String sz = size ? Common::String::format("-%d", size) : "";
-					fileChecksum.push_back(Common::String::format("md5-r%s", sz.c_str()));
-					fileChecksum.push_back(macFile.computeResForkMD5AsString(size, false, progressUpdateCallback, this));
-				}
-				// Tail checksums with checksize 5000
-				fileChecksum.push_back("md5-rt-5000");
-				fileChecksum.push_back(macFile.computeResForkMD5AsString(5000, true, progressUpdateCallback, this).c_str());
-			}
+		g_checksum_state->totalSize += file.size;
+		g_checksum_state->files.push_back(file);
+	}
+}
 
-			fileChecksum.push_back("size");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getDataForkSize()));
+void IntegrityDialog::fileChecksummed(uint index) {
+	g_checksum_state->filesDone++;
 
-			fileChecksum.push_back("size-r");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkSize()));
+	if (!g_checksum_state->fileChecksums[index].empty())
+		return;
 
-			fileChecksum.push_back("size-rd");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkDataSize()));
+	// Report the files which cannot be read right away, the server would only list them as missing
+	const Common::Path &filename = g_checksum_state->files[index].path;
+	warning("Failed to read file: %s", filename.toString().c_str());
 
-			fileChecksums.push_back(fileChecksum);
+	Common::U32String message = Common::U32String::format(_("Could not read %s"), filename.toString().c_str());
+	if (g_checksum_state->stopOnError) {
+		setError(message);
+		setState(kChecksumFailed);
+	} else {
+		_errorText->setLabel(message);
+	}
+}
 
-			g_checksum_state->calculatedSize += dataForkStream->size();
+void IntegrityDialog::calculateChecksums() {
+	ChecksumDialogState &state = *g_checksum_state;
+	const uint32 startTime = g_system->getMillis();
+
+	// Files are read in chunks, from several files at once, so that they
+	// can be hashed together. Their prefix checksums are taken on the way,
+	// each file is only read once. The data and resource forks of Mac files
+	// are read one after the other, in the same lane.
+	while (!_close && g_system->getMillis() - startTime < kChecksumTimeSlice) {
+		// Start the next files in the free lanes
+		for (ChecksumLane &lane : state.lanes) {
+			while (!lane.stream && state.nextFile < state.files.size()) {
+				const uint index = state.nextFile++;
+				const ChecksumFile &file = state.files[index];
+
+				Common::SeekableReadStream *stream = nullptr;
+				if (file.macFile) {
+					lane.macFile = new Common::MacResManager();
+					if (lane.macFile->open(file.path) && lane.macFile->isMacFile())
+						stream = Common::MacResManager::openFileOrDataFork(file.path);
+				} else {
+					Common::File *plainFile = new Common::File();
+					if (plainFile->open(file.path))
+						stream = plainFile;
+					else
+						delete plainFile;
+				}
 
-			macFile.close();
+				if (stream) {
+					lane.file = index;
+					lane.fileRead = 0;
+					lane.checksums = {file.path.toString()};
+					lane.start(stream, file.macFile ? 'd' : 0);
+				} else {
+					lane.clear();
+					fileChecksummed(index);
+				}
 
-			continue;
+				if (state.state != kChecksumStateCalculating)
+					return;
+			}
 		}
 
-		Common::File file;
-		if (!file.open(filename)) {
-			warning("Failed to open file: %s", filename.toString().c_str());
-			continue;
-		}
+		// Hash the next chunk of every file
+		Common::MD5 *md5s[kChecksumLanes];
+		const byte *data[kChecksumLanes];
+		uint fullChunks = 0;
+		bool busy = false;
 
-		Common::Array<Common::String> fileChecksum = {filename.toString()};
-		// Various checksizes
-		for (auto size : {0, 5000, 1024 * 1024}) {
-			Common::String sz = size ? Common::String::format("-%d", size) : "";
-			fileChecksum.push_back(Common::String::format("md5%s", sz.c_str()));
-			fileChecksum.push_back(Common::computeStreamMD5AsString(file, size, progressUpdateCallback, this).c_str());
-			file.seek(0);
+		for (ChecksumLane &lane : state.lanes) {
+			if (!lane.stream)
+				continue;
+
+			lane.chunkSize = lane.stream->read(lane.buffer.data(), kChecksumChunkSize);
+			lane.fileRead += lane.chunkSize;
+			state.calculatedSize += lane.chunkSize;
+
+			if (lane.chunkSize == kChecksumChunkSize) {
+				md5s[fullChunks] = &lane.md5;
+				data[fullChunks++] = lane.buffer.data();
+			} else {
+				lane.md5.update(lane.buffer.data(), lane.chunkSize);
+			}
 		}
-		// Tail checksums with checksize 5000
-		file.seek(-5000, SEEK_END);
-		fileChecksum.push_back("md5-t-5000");
-		fileChecksum.push_back(Common::computeStreamMD5AsString(file, 0, progressUpdateCallback, this).c_str());
 
-		fileChecksum.push_back("size");
-		fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)file.size()));
+		if (fullChunks)
+			Common::MD5::updateMulti(md5s, data, fullChunks, kChecksumChunkSize);
 
-		file.close();
-		fileChecksums.push_back(fileChecksum);
-	}
+		for (ChecksumLane &lane : state.lanes) {
+			if (!lane.stream)
+				continue;
 
-	setState(kChecksumComplete);
-	return fileChecksums;
-}
+			if (lane.pos == 0) {
+				Common::MD5 shortPrefix;
+				shortPrefix.update(lane.buffer.data(), MIN<uint32>(lane.chunkSize, kChecksumShortSize));
+				lane.shortPrefixMD5 = shortPrefix.getDigestAsString();
+			}
 
-Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language) {
-	Common::Array<Common::StringArray> fileChecksums = {};
+			lane.pos += lane.chunkSize;
+			if (lane.pos == kChecksumPrefixSize)
+				lane.prefixMD5 = lane.md5.getDigestAsString();
+
+			if (lane.chunkSize == kChecksumChunkSize && !lane.stream->err()) {
+				busy = true;
+				continue;
+			}
+
+			if (!lane.stream->err()) {
+				const Common::String md5 = lane.md5.getDigestAsString();
+				if (lane.pos < kChecksumPrefixSize)
+					lane.prefixMD5 = md5;
 
-	// Add game path to SearchMan
-	SearchMan.addDirectory(gamePath.toString(), gamePath, 0, 20);
+				// Tail checksums with checksize 5000
+				const int64 size = lane.stream->size();
+				lane.stream->seek(MAX<int64>(size - kChecksumShortSize, 0));
+				const Common::String tailMD5 = Common::computeStreamMD5AsString(*lane.stream);
+
+				if (!lane.stream->err()) {
+					// "md5-d", "md5-dt-5000" and so on for the forks of Mac files
+					Common::String name = "md5";
+					Common::String tailName = "md5-";
+					if (lane.fork) {
+						name += Common::String::format("-%c", lane.fork);
+						tailName += lane.fork;
+					}
+					tailName += "t-5000";
+
+					lane.checksums.push_back(name);
+					lane.checksums.push_back(md5);
+					lane.checksums.push_back(name + "-5000");
+					lane.checksums.push_back(lane.shortPrefixMD5);
+					lane.checksums.push_back(name + "-1048576");
+					lane.checksums.push_back(lane.prefixMD5);
+					lane.checksums.push_back(tailName);
+					lane.checksums.push_back(tailMD5);
+
+					if (lane.fork == 'd' && lane.macFile->hasResFork()) {
+						delete lane.stream;
+						lane.start(lane.macFile->openResForkData(), 'r');
+						busy = true;
+						continue;
+					}
+
+					if (lane.macFile) {
+						lane.checksums.push_back("size");
+						lane.checksums.push_back(Common::String::format("%llu", (unsigned long long)lane.macFile->getDataForkSize()));
+						lane.checksums.push_back("size-r");
+						lane.checksums.push_back(Common::String::format("%llu", (unsigned long long)lane.macFile->getResForkSize()));
+						lane.checksums.push_back("size-rd");
+						lane.checksums.push_back(Common::String::format("%llu", (unsigned long long)lane.macFile->getResForkDataSize()));
+					} else {
+						lane.checksums.push_back("size");
+						lane.checksums.push_back(Common::String::format("%llu", (unsigned long long)size));
+					}
+
+					state.fileChecksums[lane.file] = lane.checksums;
+				}
+			}
 
-	fileChecksums = generateChecksums(gamePath, fileChecksums, gamePath);
+			// Mac files are listed with their whole resource fork, only its data is read
+			const uint64 fileSize = state.files[lane.file].size;
+			if (lane.fileRead < fileSize)
+				state.calculatedSize += fileSize - lane.fileRead;
 
+			lane.clear();
+			fileChecksummed(lane.file);
+			if (state.state != kChecksumStateCalculating)
+				return;
+		}
+
+		if (!busy && state.nextFile == state.files.size()) {
+			state.removeSearchPath();
+			setState(kChecksumComplete);
+			sendJSON();
+			return;
+		}
+	}
+}
+
+Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language) {
 	Common::JSONObject requestObject;
 
 	requestObject.setVal("gameid", new Common::JSONValue(gameid));
@@ -511,7 +642,10 @@ Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, C
 
 	Common::JSONArray filesObject;
 
-	for (Common::StringArray fileChecksum : fileChecksums) {
+	for (const Common::StringArray &fileChecksum : g_checksum_state->fileChecksums) {
+		if (fileChecksum.empty())
+			continue;
+
 		Common::JSONObject file;
 		Common::Path relativePath = Common::Path(fileChecksum[0]).relativeTo(gamePath);
 		file.setVal("name", new Common::JSONValue(relativePath.toConfig()));
@@ -541,8 +675,6 @@ Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, C
 
 	requestObject.setVal("files", new Common::JSONValue(filesObject));
 
-	SearchMan.remove(gamePath.toString());
-
 	Common::JSONValue *request = new Common::JSONValue(requestObject);
 	return request;
 }
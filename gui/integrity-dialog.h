@@ -46,6 +46,7 @@ enum ProcessState {
 	kChecksumStateNone,
 	kChecksumStateCalculating,
 	kChecksumComplete,
+	kChecksumFailed,
 	kResponseReceived
 };
 
@@ -62,7 +63,6 @@ class IntegrityDialog : public Dialog, public CommandSender {
 	ButtonWidget *_copyEmailButton;
 
 	bool _close;
-	uint32 _lastEventPoll;
 
 
 	Common::U32String getSizeLabelText();
@@ -72,20 +72,19 @@ public:
 	IntegrityDialog(Common::String endpoint, Common::String gameConfig);
 	~IntegrityDialog();
 
-
-	/**
-	 * Updates the progress bar every 500ms
-	 * Includes polling to avoid freezing when processing files
-	 */
-	bool progressUpdate(int bytesProcessed);
-
 	void sendJSON();
 	void checksumResponseCallback(const Common::JSONValue *r);
 	void errorCallback(const Networking::ErrorResponse &error);
 
-	void calculateTotalSize(Common::Path gamePath);
+	/** List the files to checksum in a directory and its subdirectories, and add up their sizes */
+	void collectFiles(const Common::Path &currentPath, const Common::Path &gamePath);
+
+	/**
+	 * Checksum the listed files for a while, so that the dialog stays responsive.
+	 * Sends the request once all of them are done.
+	 */
+	void calculateChecksums();
 
-	Common::Array<Common::StringArray> generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath);
 	Common::JSONValue *generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language);
 	void parseJSON(const Common::JSONValue *response);
 
@@ -99,6 +98,7 @@ public:
 
 private:
 	void setState(ProcessState state);
+	void fileChecksummed(uint index);
 };
 
 } // End of namespace GUI
@@ -990,6 +990,7 @@ public:
 
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
 	void handleKeyDown(Common::KeyState state) override;
+	void handleTickle() override;
 
 	LauncherDisplayType getType() const override { return kLauncherDisplayGrid; }
 
@@ -1491,6 +1492,16 @@ void LauncherGrid::handleKeyDown(Common::KeyState state) {
 	updateButtons();
 }
 
+void LauncherGrid::handleTickle() {
+	// Load the thumbnails of the grid whatever the focused widget is, unless
+	// Dialog::handleTickle() is going to tickle the grid already
+	const bool gridTickled = (_focusedWidget == _grid || _tickleWidget == _grid) &&
+		(_grid->getFlags() & WIDGET_WANT_TICKLE);
+	if (!gridTickled)
+		_grid->handleTickle();
+	LauncherDialog::handleTickle();
+}
+
 void LauncherGrid::handleCommand(CommandSender *sender, uint32 cmd, uint32 data) {
 
 	switch (cmd) {
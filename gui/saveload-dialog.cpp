@@ -174,7 +174,7 @@ enum {
 SaveLoadChooserDialog::SaveLoadChooserDialog(const Common::String &dialogName, const bool saveMode)
 	: Dialog(dialogName), _metaEngine(nullptr), _delSupport(false), _metaInfoSupport(false),
 	_thumbnailSupport(false), _saveDateSupport(false), _playTimeSupport(false), _saveMode(saveMode),
-	_dialogWasShown(false)
+	_dialogWasShown(false), _saveListIndexed(false)
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(nullptr), _gridButton(nullptr)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -190,7 +190,7 @@ SaveLoadChooserDialog::SaveLoadChooserDialog(const Common::String &dialogName, c
 SaveLoadChooserDialog::SaveLoadChooserDialog(int x, int y, int w, int h, const bool saveMode)
 	: Dialog(x, y, w, h), _metaEngine(nullptr), _delSupport(false), _metaInfoSupport(false),
 	_thumbnailSupport(false), _saveDateSupport(false), _playTimeSupport(false), _saveMode(saveMode),
-	_dialogWasShown(false)
+	_dialogWasShown(false), _saveListIndexed(false)
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(nullptr), _gridButton(nullptr)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -217,6 +217,10 @@ void SaveLoadChooserDialog::open() {
 }
 
 void SaveLoadChooserDialog::close() {
+	// Keep the meta infos queried while the dialog was shown
+	if (_saveIndex)
+		_saveIndex->save();
+
 	Dialog::close();
 }
 
@@ -326,7 +330,11 @@ void SaveLoadChooserDialog::updateSaveList(bool external) {
 
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
-	_saveList = _metaEngine->listSaves(_target.c_str(), _saveMode);
+	if (_saveIndex)
+		_saveIndex->save();
+
+	_saveIndex.reset(new SaveStateIndex(_target));
+	_saveList = _metaEngine->listIndexedSaves(_target.c_str(), _saveMode, *_saveIndex, _saveListIndexed);
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	//if there is Cloud support, add currently synced files as "locked" saves in the list
@@ -356,6 +364,17 @@ void SaveLoadChooserDialog::listSaves() {
 #endif
 }
 
+SaveStateDescriptor SaveLoadChooserDialog::querySaveMetaInfos(uint index) const {
+	const SaveStateDescriptor &save = _saveList[index];
+	if (save.getLocked())
+		return save;
+
+	if (_saveListIndexed)
+		return _metaEngine->queryIndexedSaveMetaInfos(_target.c_str(), save.getSaveSlot(), *_saveIndex);
+
+	return _metaEngine->querySaveMetaInfos(_target.c_str(), save.getSaveSlot());
+}
+
 void SaveLoadChooserDialog::activate(int slot, const Common::U32String &description) {
 	if (!_saveList.empty() && slot < int(_saveList.size())) {
 		const SaveStateDescriptor &desc = _saveList[slot];
@@ -654,7 +673,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = querySaveMetaInfos(selItem);
 		if (!_saveList[selItem].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[selItem] = desc;
 
@@ -1169,7 +1188,7 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		SaveStateDescriptor desc = querySaveMetaInfos(i);
 		if (!_saveList[i].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[i] = desc;
 		SlotButton &curButton = _buttons[curNum];
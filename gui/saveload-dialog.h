@@ -26,6 +26,9 @@
 #include "gui/widgets/list.h"
 
 #include "engines/metaengine.h"
+#include "engines/saveindex.h"
+
+#include "common/ptr.h"
 
 namespace GUI {
 
@@ -112,6 +115,9 @@ protected:
 	*/
 	virtual void listSaves();
 
+	/** Get the meta infos of an entry of the save list, from the save index when possible. */
+	SaveStateDescriptor querySaveMetaInfos(uint index) const;
+
 	void activate(int slot, const Common::U32String &description);
 
 	const bool					_saveMode;
@@ -124,6 +130,8 @@ protected:
 	Common::String				_target;
 	bool _dialogWasShown;
 	SaveStateList				_saveList;
+	Common::ScopedPtr<SaveStateIndex> _saveIndex;
+	bool						_saveListIndexed; ///< Whether _saveIndex can be used for the meta infos
 	Common::U32String			_resultString;
 
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
@@ -20,6 +20,7 @@
  */
 
 #include "common/system.h"
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/language.h"
 #include "common/platform.h"
@@ -398,6 +399,142 @@ Graphics::ManagedSurface *loadSurfaceFromFile(const Common::String &name, int re
 	return surf;
 }
 
+// Scaled thumbnails are kept in the icons path, so that they do not have to be
+// decoded and scaled again next time. They are checked against the icons pack
+// the source file comes from, and its size and checksum in that pack, which
+// are read from the pack directory without inflating the file.
+static const uint32 kThumbnailCacheVersion = 2;
+
+struct ThumbnailSource {
+	Common::String pack;
+	uint32 size;
+	uint32 crc;
+};
+
+static Common::Path thumbnailCachePath(const Common::String &name, int width, int height) {
+	Common::Path iconsPath = ConfMan.getPath("iconspath");
+	if (iconsPath.empty())
+		return Common::Path();
+
+	Common::String fileName = Common::lastPathComponent(name, '/');
+	if (fileName.hasSuffix(".png"))
+		fileName.erase(fileName.size() - 4);
+
+	return iconsPath.join(Common::String::format("thumbnails/%s-%dx%d.thumb", fileName.c_str(), width, height));
+}
+
+static Graphics::ManagedSurface *loadCachedThumbnail(const Common::Path &cachePath, const ThumbnailSource &source) {
+	Common::File file;
+	if (!file.open(Common::FSNode(cachePath)))
+		return nullptr;
+
+	if (file.readUint32BE() != MKTAG('G', 'T', 'H', 'M') || file.readUint32LE() != kThumbnailCacheVersion ||
+		file.readString() != source.pack || file.readUint32LE() != source.size || file.readUint32LE() != source.crc)
+		return nullptr;
+
+	Graphics::PixelFormat format;
+	format.bytesPerPixel = file.readByte();
+	format.rLoss = file.readByte();
+	format.gLoss = file.readByte();
+	format.bLoss = file.readByte();
+	format.aLoss = file.readByte();
+	format.rShift = file.readByte();
+	format.gShift = file.readByte();
+	format.bShift = file.readByte();
+	format.aShift = file.readByte();
+	const int16 w = file.readSint16LE();
+	const int16 h = file.readSint16LE();
+
+	if (file.err() || file.eos() || w <= 0 || h <= 0 || format.bytesPerPixel < 2 || format.bytesPerPixel > 4)
+		return nullptr;
+
+	Graphics::ManagedSurface *surf = new Graphics::ManagedSurface(w, h, format);
+	const uint32 rowSize = w * format.bytesPerPixel;
+	for (int y = 0; y < h; ++y) {
+		if (file.read(surf->getBasePtr(0, y), rowSize) != rowSize) {
+			delete surf;
+			return nullptr;
+		}
+	}
+	return surf;
+}
+
+static void saveCachedThumbnail(const Common::Path &cachePath, const ThumbnailSource &source, const Graphics::ManagedSurface &surf) {
+	Common::DumpFile file;
+	if (!file.open(cachePath, true))
+		return;
+
+	file.writeUint32BE(MKTAG('G', 'T', 'H', 'M'));
+	file.writeUint32LE(kThumbnailCacheVersion);
+	file.writeString(source.pack);
+	file.writeByte(0);
+	file.writeUint32LE(source.size);
+	file.writeUint32LE(source.crc);
+	file.writeByte(surf.format.bytesPerPixel);
+	file.writeByte(surf.format.rLoss);
+	file.writeByte(surf.format.gLoss);
+	file.writeByte(surf.format.bLoss);
+	file.writeByte(surf.format.aLoss);
+	file.writeByte(surf.format.rShift);
+	file.writeByte(surf.format.gShift);
+	file.writeByte(surf.format.bShift);
+	file.writeByte(surf.format.aShift);
+	file.writeSint16LE(surf.w);
+	file.writeSint16LE(surf.h);
+	for (int y = 0; y < surf.h; ++y)
+		file.write(surf.getBasePtr(0, y), surf.w * surf.format.bytesPerPixel);
+
+	file.finalize();
+	file.close();
+}
+
+// Load an image file scaled to fit into the given size, from the thumbnail cache if possible.
+static const Graphics::ManagedSurface *loadThumbnail(const Common::String &name, int width, int height) {
+	const Common::Path path(name);
+	ThumbnailSource source;
+
+	g_gui.lockIconsSet();
+	Common::SearchSet &iconsSet = g_gui.getIconsSet();
+	source.pack = iconsSet.getArchiveNameForMember(path);
+	bool found = !source.pack.empty() && iconsSet.getMemberInfo(path, source.size, source.crc);
+	if (!found && !source.pack.empty()) {
+		// The archive does not record the checksum, fall back to the size
+		Common::SeekableReadStream *stream = iconsSet.createReadStreamForMember(path);
+		if (stream) {
+			source.size = stream->size();
+			source.crc = 0;
+			found = true;
+			delete stream;
+		}
+	}
+	g_gui.unlockIconsSet();
+
+	if (!found)
+		return nullptr;
+
+	const Common::Path cachePath = thumbnailCachePath(name, width, height);
+	if (!cachePath.empty()) {
+		Graphics::ManagedSurface *surf = loadCachedThumbnail(cachePath, source);
+		if (surf)
+			return surf;
+	}
+
+	Graphics::ManagedSurface *surf = loadSurfaceFromFile(name);
+	if (!surf)
+		return nullptr;
+
+	const Graphics::ManagedSurface *scSurf = scaleGfx(surf, width, height, true);
+	if (surf != scSurf) {
+		surf->free();
+		delete surf;
+	}
+
+	if (!cachePath.empty())
+		saveCachedThumbnail(cachePath, source, *scSurf);
+
+	return scSurf;
+}
+
 #pragma mark -
 
 GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
@@ -474,7 +611,7 @@ void GridWidget::unloadSurfaces(Common::HashMap<T, const Graphics::ManagedSurfac
 const Graphics::ManagedSurface *GridWidget::filenameToSurface(const Common::String &name) {
 	if (name.empty())
 		return nullptr;
-	return _loadedSurfaces[name];
+	return _loadedSurfaces.getValOrDefault(name);
 }
 
 const Graphics::ManagedSurface *GridWidget::languageToSurface(Common::Language languageCode, Graphics::AlphaType &alphaType) {
@@ -698,46 +835,69 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 }
 
 void GridWidget::reloadThumbnails() {
-	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
-	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
+	// The thumbnails are loaded a few at a time in handleTickle(), only keep
+	// the ones which are still visible
+	_pendingThumbnails.clear();
 	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
 		GridItemInfo *entry = *iter;
-		if (entry->thumbPath.empty())
+		if (entry->thumbPath.empty() || _loadedSurfaces.contains(entry->thumbPath))
 			continue;
 
-		if (!_loadedSurfaces.contains(entry->thumbPath)) {
-			_loadedSurfaces[entry->thumbPath] = nullptr;
-			Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
-			Graphics::ManagedSurface *surf = loadSurfaceFromFile(path);
-			if (!surf) {
-				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
-				if (!_loadedSurfaces.contains(path)) {
-					surf = loadSurfaceFromFile(path);
-				} else {
-					const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path];
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[entry->thumbPath] = thSurf;
-				}
-			}
+		PendingThumbnail thumbnail;
+		thumbnail.path = entry->thumbPath;
+		thumbnail.enginePath = Common::String::format("icons/%s.png", entry->engineid.c_str());
+		_pendingThumbnails.push_back(thumbnail);
+	}
+}
 
-			if (surf) {
-				const Graphics::ManagedSurface *scSurf(scaleGfx(surf, thumbnailWidth, thumbnailHeight, true));
-				_loadedSurfaces[entry->thumbPath] = scSurf;
+bool GridWidget::loadPendingThumbnail(const PendingThumbnail &thumbnail) {
+	// Entries of the same game may share their thumbnail
+	if (_loadedSurfaces.contains(thumbnail.path))
+		return false;
 
-				if (path != entry->thumbPath) {
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[path] = thSurf;
-				}
+	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
+	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
 
-				if (surf != scSurf) {
-					surf->free();
-					delete surf;
-				}
-			}
+	const Graphics::ManagedSurface *surf = loadThumbnail(thumbnail.path, thumbnailWidth, thumbnailHeight);
+	if (!surf) {
+		if (!_loadedSurfaces.contains(thumbnail.enginePath))
+			_loadedSurfaces[thumbnail.enginePath] = loadThumbnail(thumbnail.enginePath, thumbnailWidth, thumbnailHeight);
+
+		const Graphics::ManagedSurface *engineSurf = _loadedSurfaces[thumbnail.enginePath];
+		if (engineSurf) {
+			// TODO: Use SharedPtr instead of duplicating the surface
+			Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
+			thSurf->copyFrom(*engineSurf);
+			surf = thSurf;
+		}
+	}
+
+	_loadedSurfaces[thumbnail.path] = surf;
+	return true;
+}
+
+void GridWidget::handleTickle() {
+	if (_pendingThumbnails.empty())
+		return;
+
+	// Keep some time for the events and drawing, so that scrolling does not stutter
+	const uint32 kLoadingTime = 10;
+	const uint32 start = g_system->getMillis();
+
+	Common::HashMap<Common::String, bool> loaded;
+	uint done = 0;
+	while (done < _pendingThumbnails.size() && g_system->getMillis() - start < kLoadingTime) {
+		if (loadPendingThumbnail(_pendingThumbnails[done]))
+			loaded[_pendingThumbnails[done].path] = true;
+		++done;
+	}
+	_pendingThumbnails.erase(_pendingThumbnails.begin(), _pendingThumbnails.begin() + done);
+
+	for (Common::Array<GridItemWidget *>::iterator i = _gridItems.begin(); i != _gridItems.end(); ++i) {
+		const GridItemInfo *entry = (*i)->getActiveEntry();
+		if ((*i)->isVisible() && entry && loaded.contains(entry->thumbPath)) {
+			(*i)->updateThumb();
+			(*i)->markAsDirty();
 		}
 	}
 }
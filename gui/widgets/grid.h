@@ -109,6 +109,15 @@ protected:
 	// Images are mapped by filename -> surface.
 	Common::HashMap<Common::String, const Graphics::ManagedSurface *> _loadedSurfaces;
 
+	// Thumbnails of the visible entries still to be loaded, see handleTickle()
+	struct PendingThumbnail {
+		Common::String path;
+		Common::String enginePath;
+	};
+	Common::Array<PendingThumbnail>	_pendingThumbnails;
+
+	bool loadPendingThumbnail(const PendingThumbnail &thumbnail);
+
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_headerEntryList;
 	Common::Array<GridItemInfo *>		_sortedEntryList;
@@ -219,6 +228,7 @@ public:
 
 	void handleMouseWheel(int x, int y, int direction) override;
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
+	void handleTickle() override;
 	void reflowLayout() override;
 
 	bool wantsFocus() override { return true; }
@@ -247,6 +257,7 @@ public:
 	void update();
 	void updateThumb();
 	void setActiveEntry(GridItemInfo &entry);
+	const GridItemInfo *getActiveEntry() const { return _activeEntry; }
 
 	void drawWidget() override;
 
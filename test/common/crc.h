@@ -1,7 +1,18 @@
 #include <cxxtest/TestSuite.h>
 
+#include "common/array.h"
 #include "common/crc.h"
 #include "common/crc_slow.h"
+#include "common/debug.h"
+#include "common/system.h"
+
+#include "../null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
 
 namespace {
 const byte *testStringCRC = (const byte *)"The quick brown fox jumps over the lazy dog";
@@ -21,6 +32,61 @@ public:
 		TS_ASSERT_EQUALS(crc.finalize(running), 0x414fa339U);
 	}
 
+	void test_crc32_block() {
+		Common::CRC32 crc;
+		byte data[100];
+		for (int i = 0; i < 100; i++)
+			data[i] = i * 37 + 11;
+
+		// All the lengths and alignments, against the byte-wise computation
+		for (int start = 0; start < 8; start++) {
+			for (int length = 0; start + length <= 100; length++) {
+				uint32 expected = crc.getInitRemainder();
+				for (int i = 0; i < length; i++)
+					expected = crc.processByte(data[start + i], expected);
+
+				TS_ASSERT_EQUALS(crc.processBlock(data + start, length, crc.getInitRemainder()), expected);
+				TS_ASSERT_EQUALS(crc.crcFast(data + start, length), crc.finalize(expected));
+			}
+		}
+
+		// Split blocks continue the running CRC
+		uint32 running = crc.processBlock(testStringCRC, 13, crc.getInitRemainder());
+		running = crc.processBlock(testStringCRC + 13, testLenCRC - 13, running);
+		TS_ASSERT_EQUALS(crc.finalize(running), 0x414fa339U);
+	}
+
+	void test_crc32_speed() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+
+#ifdef SLOW_TESTS
+		const uint32 size = 256 * 1024 * 1024;
+#else
+		const uint32 size = 1024 * 1024;
+#endif
+		Common::Array<byte> data(size);
+		for (uint32 i = 0; i < size; i++)
+			data[i] = i * 37 + (i >> 8);
+
+		Common::CRC32 crc;
+		uint32 start = g_system->getMillis();
+		uint32 byteCRC = crc.getInitRemainder();
+		for (uint32 i = 0; i < size; i++)
+			byteCRC = crc.processByte(data[i], byteCRC);
+		const uint32 byteTime = g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		const uint32 blockCRC = crc.processBlock(data.data(), size, crc.getInitRemainder());
+		const uint32 blockTime = g_system->getMillis() - start;
+
+		TS_ASSERT_EQUALS(blockCRC, byteCRC);
+
+		debug("CRC32 of %u bytes, byte at a time (in milliseconds): %u\n", size, byteTime);
+		debug("CRC32 of %u bytes, slicing-by-8 (in milliseconds): %u\n", size, blockTime);
+#endif
+	}
+
 	void test_crc16() {
 		Common::CRC16 crc;
 		TS_ASSERT_EQUALS(crc.crcFast(testStringCRC, testLenCRC), 0xfcdfU);
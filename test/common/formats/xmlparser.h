@@ -0,0 +1,77 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/formats/xmlparser.h"
+
+static const char TEST_XML[] =
+	"<?xml version = '1.0'?>\n"
+	"<!-- comment -->\n"
+	"<layout name = 'main' width = '320'>\n"
+	"\t<widget name = \"button\" type = 'Button'/>\n"
+	"\t<widget name = 'list' type = 'List'>\n"
+	"\t\t<widget name = 'scrollbar'/>\n"
+	"\t</widget>\n"
+	"</layout>\n";
+
+class XMLTestParser : public Common::XMLParser {
+public:
+	Common::String log;
+
+protected:
+	CUSTOM_XML_PARSER(XMLTestParser) {
+		XML_KEY(layout)
+			XML_PROP(name, true)
+			XML_PROP(width, false)
+			XML_KEY(widget)
+				XML_PROP(name, true)
+				XML_PROP(type, false)
+				XML_KEY_RECURSIVE(widget)
+			KEY_END()
+		KEY_END()
+	} PARSER_END()
+
+	bool parserCallback_layout(ParserNode *node) {
+		log += "layout:" + node->values["name"] + ":" + node->values["width"] + ";";
+		return true;
+	}
+
+	bool parserCallback_widget(ParserNode *node) {
+		log += Common::String::format("widget%d:", node->depth) + node->values["name"] + ":" + node->values["type"] + ";";
+		return true;
+	}
+
+	bool closedKeyCallback(ParserNode *node) override {
+		log += "/" + node->name + ";";
+		return true;
+	}
+};
+
+class XMLParserTestSuite : public CxxTest::TestSuite {
+public:
+	void test_compiled() {
+		Common::MemoryWriteStreamDynamic compiled(DisposeAfterUse::YES);
+
+		XMLTestParser parser;
+		TS_ASSERT(parser.loadBuffer((const byte *)TEST_XML, sizeof(TEST_XML) - 1));
+		parser.setCompiledOutput(&compiled);
+		TS_ASSERT(parser.parse());
+		parser.setCompiledOutput(nullptr);
+		parser.close();
+
+		TS_ASSERT_EQUALS(parser.log, "/xml;layout:main:320;widget1:button:Button;/widget;"
+			"widget1:list:List;widget2:scrollbar:;/widget;/widget;/layout;");
+
+		// Replaying the compiled keys issues the same callbacks
+		XMLTestParser replay;
+		TS_ASSERT(replay.loadBuffer(compiled.getData(), compiled.size()));
+		TS_ASSERT(replay.parseCompiled());
+		replay.close();
+		TS_ASSERT_EQUALS(replay.log, parser.log);
+
+		// Truncated data is rejected
+		XMLTestParser truncated;
+		TS_ASSERT(truncated.loadBuffer(compiled.getData(), compiled.size() - 1));
+		TS_ASSERT(!truncated.parseCompiled());
+		truncated.close();
+	}
+};
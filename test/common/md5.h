@@ -1,7 +1,19 @@
 #include <cxxtest/TestSuite.h>
 
+#include "common/array.h"
+#include "common/debug.h"
 #include "common/md5.h"
+#include "common/memstream.h"
 #include "common/stream.h"
+#include "common/system.h"
+
+#include "../null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
 
 /*
  * those are the standard RFC 1321 test vectors
@@ -47,4 +59,105 @@ class MD5TestSuite : public CxxTest::TestSuite {
 		}
 	}
 
+	void test_incremental() {
+		for (int i = 0; i < 7; i++) {
+			const byte *data = (const byte *)md5_test_string[i];
+			const uint32 size = strlen(md5_test_string[i]);
+
+			Common::MD5 md5;
+			md5.update(data, size / 3);
+			md5.update(data + size / 3, size - size / 3);
+			TS_ASSERT_EQUALS(md5.getDigestAsString(), md5_test_digest[i]);
+
+			// Getting the digest does not prevent adding more data
+			Common::MD5 prefix;
+			prefix.update(data, size / 2);
+			prefix.getDigestAsString();
+			prefix.update(data + size / 2, size - size / 2);
+			TS_ASSERT_EQUALS(prefix.getDigestAsString(), md5_test_digest[i]);
+		}
+	}
+
+	void test_computeStreamsMD5() {
+		// Sizes around the block and read sizes, so that lanes finish at different times
+		static const uint32 sizes[] = { 0, 1, 63, 64, 65, 16384, 16385, 40000, 100000 };
+		const uint count = ARRAYSIZE(sizes);
+
+		Common::Array<byte> data(100000);
+		for (uint32 i = 0; i < data.size(); i++)
+			data[i] = i * 13 + (i >> 10);
+
+		for (uint32 length = 0; length <= 20000; length += 20000) {
+			Common::Array<Common::MemoryReadStream *> streams;
+			for (uint i = 0; i < count; i++)
+				streams.push_back(new Common::MemoryReadStream(data.data() + i, sizes[i]));
+
+			Common::Array<uint8> digests(count * 16);
+			TS_ASSERT(Common::computeStreamsMD5((Common::ReadStream *const *)streams.data(), count, (uint8 (*)[16])digests.data(), length));
+
+			for (uint i = 0; i < count; i++) {
+				uint8 expected[16];
+				streams[i]->seek(0);
+				Common::computeStreamMD5(*streams[i], expected, length);
+				TS_ASSERT_SAME_DATA(digests.data() + i * 16, expected, 16);
+				delete streams[i];
+			}
+		}
+
+		// Four checksums updated together match separate ones, even when
+		// one of them has buffered data
+		for (uint32 offset = 0; offset <= 1; offset++) {
+			Common::MD5 single[4], multi[4];
+			Common::MD5 *const md5s[4] = { &multi[0], &multi[1], &multi[2], &multi[3] };
+			const byte *const blocks[4] = { data.data(), data.data() + 1000, data.data() + 2000, data.data() + 3000 };
+
+			single[3].update(data.data(), offset);
+			multi[3].update(data.data(), offset);
+			for (int i = 0; i < 4; i++)
+				single[i].update(blocks[i], 300);
+			Common::MD5::updateMulti(md5s, blocks, 4, 300);
+
+			for (int i = 0; i < 4; i++)
+				TS_ASSERT_EQUALS(multi[i].getDigestAsString(), single[i].getDigestAsString());
+		}
+	}
+
+	void test_md5_speed() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+
+#ifdef SLOW_TESTS
+		const uint32 size = 64 * 1024 * 1024;
+#else
+		const uint32 size = 256 * 1024;
+#endif
+		const uint count = 4;
+		Common::Array<byte> data(size);
+		for (uint32 i = 0; i < size; i++)
+			data[i] = i * 13 + (i >> 10);
+
+		uint32 start = g_system->getMillis();
+		for (uint i = 0; i < count; i++) {
+			Common::MemoryReadStream stream(data.data(), size);
+			Common::computeStreamMD5AsString(stream);
+		}
+		const uint32 singleTime = g_system->getMillis() - start;
+
+		Common::ReadStream *streams[count];
+		for (uint i = 0; i < count; i++)
+			streams[i] = new Common::MemoryReadStream(data.data(), size);
+		uint8 digests[count][16];
+
+		start = g_system->getMillis();
+		Common::computeStreamsMD5(streams, count, digests);
+		const uint32 multiTime = g_system->getMillis() - start;
+
+		for (uint i = 0; i < count; i++)
+			delete streams[i];
+
+		debug("MD5 of %u streams of %u bytes, one after the other (in milliseconds): %u\n", count, size, singleTime);
+		debug("MD5 of %u streams of %u bytes, together (in milliseconds): %u\n", count, size, multiTime);
+#endif
+	}
+
 };
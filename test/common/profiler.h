@@ -0,0 +1,68 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/profiler.h"
+#include "common/str.h"
+#include "../null_osystem.h"
+
+class ProfilerTestSuite : public CxxTest::TestSuite {
+public:
+	void test_frame_stats() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		ProfMan.reset();
+		ProfMan.setEnabled(true);
+		ProfMan.endFrame();
+
+		const uint64 start = ProfMan.getTime();
+		ProfMan.addScope(Common::kProfilerTrackMain, "draw", start, start);
+		ProfMan.addScope(Common::kProfilerTrackMain, "script", start, start);
+		ProfMan.addScope(Common::kProfilerTrackMain, "draw", start, start);
+		ProfMan.addScope(Common::kProfilerTrackAudio, "mix", start, start);
+		ProfMan.endFrame();
+		ProfMan.setEnabled(false);
+
+		TS_ASSERT_EQUALS(ProfMan.getFrameCount(), 2u);
+
+		Common::Array<Common::Profiler::ScopeStats> stats;
+		ProfMan.getLastFrameStats(stats);
+		TS_ASSERT_EQUALS(stats.size(), 2u);
+		TS_ASSERT_EQUALS(Common::String(stats[0].name), "draw");
+		TS_ASSERT_EQUALS(stats[0].calls, 2u);
+		TS_ASSERT_EQUALS(Common::String(stats[1].name), "script");
+		TS_ASSERT_EQUALS(stats[1].calls, 1u);
+
+		ProfMan.getLastFrameStats(stats, Common::kProfilerTrackAudio);
+		TS_ASSERT_EQUALS(stats.size(), 1u);
+
+		// Nothing is recorded while disabled
+		ProfMan.addScope(Common::kProfilerTrackMain, "late", start, start);
+		ProfMan.endFrame();
+		TS_ASSERT_EQUALS(ProfMan.getFrameCount(), 2u);
+#endif
+	}
+
+	void test_chrome_trace() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		ProfMan.reset();
+		ProfMan.setEnabled(true);
+		{
+			PROFILE_SCOPE("quoted \"scope\"");
+		}
+		ProfMan.setCounter("objects", 42);
+		ProfMan.endFrame();
+		ProfMan.setEnabled(false);
+
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+		TS_ASSERT(ProfMan.writeChromeTrace(stream));
+		const Common::String json((const char *)stream.getData(), stream.size());
+
+		TS_ASSERT(json.hasPrefix("{\"traceEvents\":["));
+		TS_ASSERT(json.contains("\"name\":\"quoted \\\"scope\\\"\",\"ph\":\"X\""));
+		TS_ASSERT(json.contains("\"name\":\"objects\",\"ph\":\"C\""));
+		TS_ASSERT(json.contains("\"args\":{\"value\":42}"));
+		TS_ASSERT(json.contains("\"name\":\"Frame 0\""));
+#endif
+	}
+};
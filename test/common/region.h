@@ -0,0 +1,126 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/region.h"
+
+class RegionTestSuite : public CxxTest::TestSuite {
+	enum {
+		kSize = 32
+	};
+
+	// Check the region covers exactly the pixels set in the mask, with
+	// non-overlapping rectangles in banded order
+	static bool matches(const Common::Region &region, const bool mask[kSize][kSize]) {
+		const Common::Array<Common::Rect> &rects = region.getRects();
+		for (uint i = 1; i < rects.size(); ++i) {
+			const Common::Rect &prev = rects[i - 1];
+			const Common::Rect &cur = rects[i];
+			if (cur.top == prev.top) {
+				if (cur.bottom != prev.bottom || cur.left <= prev.right)
+					return false;
+			} else if (cur.top < prev.bottom) {
+				return false;
+			}
+		}
+
+		for (int y = 0; y < kSize; ++y) {
+			for (int x = 0; x < kSize; ++x) {
+				if (region.contains(x, y) != mask[y][x])
+					return false;
+			}
+		}
+		return true;
+	}
+
+	static void fill(bool mask[kSize][kSize], const Common::Rect &r, bool value) {
+		for (int y = r.top; y < r.bottom; ++y)
+			for (int x = r.left; x < r.right; ++x)
+				mask[y][x] = value;
+	}
+
+public:
+	void test_unite() {
+		Common::Region region;
+		TS_ASSERT(region.isEmpty());
+
+		region.unite(Common::Rect(0, 0, 10, 10));
+		region.unite(Common::Rect(5, 5, 15, 15));
+		TS_ASSERT_EQUALS(region.size(), 3u);
+		TS_ASSERT_EQUALS(region.getArea(), 175u);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(0, 0, 15, 15));
+
+		// Adjacent rectangles are coalesced
+		Common::Region strip;
+		strip.unite(Common::Rect(0, 0, 10, 5));
+		strip.unite(Common::Rect(0, 5, 10, 10));
+		strip.unite(Common::Rect(10, 0, 20, 10));
+		TS_ASSERT_EQUALS(strip.size(), 1u);
+		TS_ASSERT_EQUALS(strip.getRects()[0], Common::Rect(0, 0, 20, 10));
+	}
+
+	void test_intersect_subtract() {
+		Common::Region region(Common::Rect(0, 0, 10, 10));
+		region.subtract(Common::Rect(3, 3, 6, 6));
+		TS_ASSERT_EQUALS(region.size(), 4u);
+		TS_ASSERT_EQUALS(region.getArea(), 91u);
+		TS_ASSERT(!region.contains(4, 4));
+		TS_ASSERT(!region.intersects(Common::Rect(3, 3, 6, 6)));
+		TS_ASSERT(region.intersects(Common::Rect(2, 2, 4, 4)));
+
+		region.intersect(Common::Rect(0, 0, 5, 5));
+		TS_ASSERT_EQUALS(region.getArea(), 21u);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(0, 0, 5, 5));
+
+		region.intersect(Common::Rect(20, 20, 30, 30));
+		TS_ASSERT(region.isEmpty());
+	}
+
+	void test_simplify() {
+		Common::Region region;
+		region.unite(Common::Rect(0, 0, 4, 4));
+		region.unite(Common::Rect(6, 6, 10, 10));
+
+		// 32 pixels in two rectangles, against 100 pixels for the bounds
+		TS_ASSERT(!region.simplify(16));
+		TS_ASSERT_EQUALS(region.size(), 2u);
+		TS_ASSERT(region.simplify(100));
+		TS_ASSERT_EQUALS(region.size(), 1u);
+		TS_ASSERT_EQUALS(region.getRects()[0], Common::Rect(0, 0, 10, 10));
+	}
+
+	void test_random_operations() {
+		bool mask[kSize][kSize] = {};
+		Common::Region region;
+
+		uint32 seed = 12345;
+		for (int i = 0; i < 500; ++i) {
+			seed = seed * 1103515245 + 12345;
+			int x1 = (seed >> 8) % kSize, y1 = (seed >> 16) % kSize;
+			seed = seed * 1103515245 + 12345;
+			int x2 = (seed >> 8) % kSize, y2 = (seed >> 16) % kSize;
+			Common::Rect r(MIN(x1, x2), MIN(y1, y2), MAX(x1, x2) + 1, MAX(y1, y2) + 1);
+
+			switch ((seed >> 24) % 4) {
+			case 0:
+			case 1:
+				region.unite(r);
+				fill(mask, r, true);
+				break;
+			case 2:
+				region.subtract(r);
+				fill(mask, r, false);
+				break;
+			default: {
+				Common::Region other(r);
+				other.subtract(Common::Rect(r.left, r.top, r.left + r.width() / 2, r.bottom));
+				region.intersect(other);
+				for (int y = 0; y < kSize; ++y)
+					for (int x = 0; x < kSize; ++x)
+						mask[y][x] = mask[y][x] && other.contains(x, y);
+				break;
+			}
+			}
+
+			TS_ASSERT(matches(region, mask));
+		}
+	}
+};
@@ -0,0 +1,123 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/rewindbuffer.h"
+
+class RewindBufferTestSuite : public CxxTest::TestSuite {
+	static uint32 nextRandom(uint32 &seed) {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 16;
+	}
+
+	// Fill with runs of a few values, which compresses but not trivially
+	static void fill(Common::Array<byte> &data, uint32 size, uint32 seed) {
+		data.resize(size);
+		uint32 i = 0;
+		while (i < size) {
+			const byte value = nextRandom(seed) % 4;
+			const uint32 run = 1 + nextRandom(seed) % 20;
+			for (uint32 j = 0; j < run && i < size; ++j)
+				data[i++] = value;
+		}
+	}
+
+	static bool roundTrip(const Common::Array<byte> &data) {
+		Common::Array<byte> compressed(Common::RewindBuffer::getMaxCompressedSize(data.size()));
+		const uint32 size = Common::RewindBuffer::compress(data.data(), data.size(), compressed.data());
+		if (size > compressed.size())
+			return false;
+
+		Common::Array<byte> decompressed(data.size());
+		return Common::RewindBuffer::decompress(compressed.data(), size, decompressed.data(), decompressed.size()) &&
+			decompressed == data;
+	}
+
+public:
+	void test_codec() {
+		Common::Array<byte> data;
+		TS_ASSERT(roundTrip(data));
+
+		fill(data, 5000, 1);
+		TS_ASSERT(roundTrip(data));
+
+		// Incompressible data
+		uint32 seed = 2;
+		for (uint32 i = 0; i < data.size(); ++i)
+			data[i] = nextRandom(seed);
+		TS_ASSERT(roundTrip(data));
+
+		// Long runs, with extended lengths
+		data.resize(100000);
+		for (uint32 i = 0; i < data.size(); ++i)
+			data[i] = (i / 1000) & 1;
+		TS_ASSERT(roundTrip(data));
+
+		// Truncated data is rejected
+		Common::Array<byte> compressed(Common::RewindBuffer::getMaxCompressedSize(data.size()));
+		const uint32 size = Common::RewindBuffer::compress(data.data(), data.size(), compressed.data());
+		TS_ASSERT(size < data.size() / 10);
+		Common::Array<byte> decompressed(data.size());
+		TS_ASSERT(!Common::RewindBuffer::decompress(compressed.data(), size - 1, decompressed.data(), decompressed.size()));
+	}
+
+	void test_push_pop() {
+		Common::RewindBuffer buffer(1024 * 1024, 256);
+		Common::Array<byte> first, second, third, data;
+		fill(first, 10000, 1);
+		second = first;
+		second[5000] ^= 0xFF;
+		fill(third, 9000, 3);
+
+		buffer.push(first.data(), first.size());
+		const uint32 firstUsage = buffer.getMemoryUsage();
+
+		// Only the changed block is stored again
+		buffer.push(second.data(), second.size());
+		TS_ASSERT(buffer.getMemoryUsage() - firstUsage < 1000);
+
+		buffer.push(third.data(), third.size());
+		TS_ASSERT_EQUALS(buffer.size(), 3u);
+
+		TS_ASSERT(buffer.pop(data));
+		TS_ASSERT(data == third);
+
+		// Pushing after a pop compares against the snapshot left on top
+		buffer.push(second.data(), second.size());
+		TS_ASSERT(buffer.pop(data));
+		TS_ASSERT(data == second);
+		TS_ASSERT(buffer.pop(data));
+		TS_ASSERT(data == second);
+		TS_ASSERT(buffer.pop(data));
+		TS_ASSERT(data == first);
+
+		TS_ASSERT(!buffer.pop(data));
+		TS_ASSERT_EQUALS(buffer.getMemoryUsage(), 0u);
+	}
+
+	void test_budget() {
+		Common::RewindBuffer buffer(64 * 1024, 1024);
+		Common::Array<byte> data;
+
+		for (uint32 i = 0; i < 100; ++i) {
+			fill(data, 20000, i);
+			buffer.push(data.data(), data.size());
+			TS_ASSERT(buffer.getMemoryUsage() <= buffer.getMemoryBudget());
+		}
+
+		TS_ASSERT(buffer.size() > 1u);
+		TS_ASSERT(buffer.size() < 100u);
+		Common::Array<byte> newest;
+		fill(newest, 20000, 99);
+		TS_ASSERT(buffer.pop(data));
+		TS_ASSERT(data == newest);
+
+		// The newest snapshot is kept even if it exceeds the budget on its own
+		Common::RewindBuffer small(16, 1024);
+		small.push(data.data(), data.size());
+		small.push(data.data(), data.size());
+		TS_ASSERT_EQUALS(small.size(), 1u);
+
+		buffer.clear();
+		TS_ASSERT(buffer.empty());
+		TS_ASSERT_EQUALS(buffer.getMemoryUsage(), 0u);
+	}
+};
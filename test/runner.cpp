@@ -0,0 +1,3229 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/StdioPrinter.h>
+
+int main() {
+ return CxxTest::StdioPrinter().run();
+}
+#include "test/common/algorithm.h"
+
+static AlgorithmTestSuite suite_AlgorithmTestSuite;
+
+static CxxTest::List Tests_AlgorithmTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AlgorithmTestSuite( "test/common/algorithm.h", 10, "AlgorithmTestSuite", suite_AlgorithmTestSuite, Tests_AlgorithmTestSuite );
+
+static class TestDescription_AlgorithmTestSuite_test_check_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_check_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 67, "test_check_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_check_sort(); }
+} testDescription_AlgorithmTestSuite_test_check_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_pod_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_pod_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 78, "test_pod_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_pod_sort(); }
+} testDescription_AlgorithmTestSuite_test_pod_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_container_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 116, "test_container_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_sort(); }
+} testDescription_AlgorithmTestSuite_test_container_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_string_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_string_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 131, "test_string_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_string_replace(); }
+} testDescription_AlgorithmTestSuite_test_string_replace;
+
+static class TestDescription_AlgorithmTestSuite_test_container_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 141, "test_container_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_replace(); }
+} testDescription_AlgorithmTestSuite_test_container_replace;
+
+static class TestDescription_AlgorithmTestSuite_test_container_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_remove() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 159, "test_container_remove" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_remove(); }
+} testDescription_AlgorithmTestSuite_test_container_remove;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_equal_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_equal_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 186, "test_lower_bound_equal_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_equal_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_equal_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_greater_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_greater_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 200, "test_lower_bound_greater_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_greater_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_greater_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 214, "test_lower_bound_element_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_element_nothing_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 221, "test_lower_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_empty_input(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_empty_input;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_element_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_element_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 234, "test_upper_bound_element_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_element_found(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_element_found;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 248, "test_upper_bound_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_nothing_found(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_nothing_found;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 261, "test_upper_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_empty_input(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_empty_input;
+
+#include "test/common/array.h"
+
+static ArrayTestSuite suite_ArrayTestSuite;
+
+static CxxTest::List Tests_ArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ArrayTestSuite( "test/common/array.h", 41, "ArrayTestSuite", suite_ArrayTestSuite, Tests_ArrayTestSuite );
+
+static class TestDescription_ArrayTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 44, "test_empty_clear" ) {}
+ void runTest() { suite_ArrayTestSuite.test_empty_clear(); }
+} testDescription_ArrayTestSuite_test_empty_clear;
+
+static class TestDescription_ArrayTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 54, "test_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_iterator(); }
+} testDescription_ArrayTestSuite_test_iterator;
+
+static class TestDescription_ArrayTestSuite_test_erase_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_erase_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 82, "test_erase_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator(); }
+} testDescription_ArrayTestSuite_test_erase_iterator;
+
+static class TestDescription_ArrayTestSuite_test_erase_iterator_range : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_erase_iterator_range() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 102, "test_erase_iterator_range" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator_range(); }
+} testDescription_ArrayTestSuite_test_erase_iterator_range;
+
+static class TestDescription_ArrayTestSuite_test_insert_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 127, "test_insert_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_iterator(); }
+} testDescription_ArrayTestSuite_test_insert_iterator;
+
+static class TestDescription_ArrayTestSuite_test_direct_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_direct_access() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 149, "test_direct_access" ) {}
+ void runTest() { suite_ArrayTestSuite.test_direct_access(); }
+} testDescription_ArrayTestSuite_test_direct_access;
+
+static class TestDescription_ArrayTestSuite_test_insert_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 162, "test_insert_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at(); }
+} testDescription_ArrayTestSuite_test_insert_at;
+
+static class TestDescription_ArrayTestSuite_test_insert_at_array : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_at_array() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 183, "test_insert_at_array" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at_array(); }
+} testDescription_ArrayTestSuite_test_insert_at_array;
+
+static class TestDescription_ArrayTestSuite_test_self_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_self_insert() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 212, "test_self_insert" ) {}
+ void runTest() { suite_ArrayTestSuite.test_self_insert(); }
+} testDescription_ArrayTestSuite_test_self_insert;
+
+static class TestDescription_ArrayTestSuite_test_remove_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_remove_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 241, "test_remove_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_remove_at(); }
+} testDescription_ArrayTestSuite_test_remove_at;
+
+static class TestDescription_ArrayTestSuite_test_push_back : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_push_back() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 262, "test_push_back" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back(); }
+} testDescription_ArrayTestSuite_test_push_back;
+
+static class TestDescription_ArrayTestSuite_test_push_back_ex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_push_back_ex() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 297, "test_push_back_ex" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back_ex(); }
+} testDescription_ArrayTestSuite_test_push_back_ex;
+
+static class TestDescription_ArrayTestSuite_test_copy_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_copy_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 310, "test_copy_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_copy_constructor(); }
+} testDescription_ArrayTestSuite_test_copy_constructor;
+
+static class TestDescription_ArrayTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 332, "test_equals" ) {}
+ void runTest() { suite_ArrayTestSuite.test_equals(); }
+} testDescription_ArrayTestSuite_test_equals;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 349, "test_array_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor(); }
+} testDescription_ArrayTestSuite_test_array_constructor;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_count : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_count() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 373, "test_array_constructor_count" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count(); }
+} testDescription_ArrayTestSuite_test_array_constructor_count;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_list : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_list() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 384, "test_array_constructor_list" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_list(); }
+} testDescription_ArrayTestSuite_test_array_constructor_list;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_count_copy_value : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_count_copy_value() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 392, "test_array_constructor_count_copy_value" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count_copy_value(); }
+} testDescription_ArrayTestSuite_test_array_constructor_count_copy_value;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_str : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_str() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 416, "test_array_constructor_str" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_str(); }
+} testDescription_ArrayTestSuite_test_array_constructor_str;
+
+static class TestDescription_ArrayTestSuite_test_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_data() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 428, "test_data" ) {}
+ void runTest() { suite_ArrayTestSuite.test_data(); }
+} testDescription_ArrayTestSuite_test_data;
+
+static class TestDescription_ArrayTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 437, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ArrayTestSuite.test_front_back_push_pop(); }
+} testDescription_ArrayTestSuite_test_front_back_push_pop;
+
+static class TestDescription_ArrayTestSuite_test_resize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_resize() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 456, "test_resize" ) {}
+ void runTest() { suite_ArrayTestSuite.test_resize(); }
+} testDescription_ArrayTestSuite_test_resize;
+
+static class TestDescription_ArrayTestSuite_test_swap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_swap() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 492, "test_swap" ) {}
+ void runTest() { suite_ArrayTestSuite.test_swap(); }
+} testDescription_ArrayTestSuite_test_swap;
+
+static SortedArrayTestSuite suite_SortedArrayTestSuite;
+
+static CxxTest::List Tests_SortedArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SortedArrayTestSuite( "test/common/array.h", 533, "SortedArrayTestSuite", suite_SortedArrayTestSuite, Tests_SortedArrayTestSuite );
+
+static class TestDescription_SortedArrayTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 535, "test_insert" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_insert(); }
+} testDescription_SortedArrayTestSuite_test_insert;
+
+static class TestDescription_SortedArrayTestSuite_test_stability : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_stability() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 566, "test_stability" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_stability(); }
+} testDescription_SortedArrayTestSuite_test_stability;
+
+static class TestDescription_SortedArrayTestSuite_test_emplace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_emplace() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 597, "test_emplace" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_emplace(); }
+} testDescription_SortedArrayTestSuite_test_emplace;
+
+static class TestDescription_SortedArrayTestSuite_test_push_back_move : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_push_back_move() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 607, "test_push_back_move" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_push_back_move(); }
+} testDescription_SortedArrayTestSuite_test_push_back_move;
+
+#include "test/common/base64.h"
+
+static Base64TestSuite suite_Base64TestSuite;
+
+static CxxTest::List Tests_Base64TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Base64TestSuite( "test/common/base64.h", 45, "Base64TestSuite", suite_Base64TestSuite, Tests_Base64TestSuite );
+
+static class TestDescription_Base64TestSuite_test_b64Validate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64Validate() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 47, "test_b64Validate" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64Validate(); }
+} testDescription_Base64TestSuite_test_b64Validate;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 61, "test_b64EncodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeString(); }
+} testDescription_Base64TestSuite_test_b64EncodeString;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 69, "test_b64EncodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeStream(); }
+} testDescription_Base64TestSuite_test_b64EncodeStream;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 77, "test_b64EncodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeData(); }
+} testDescription_Base64TestSuite_test_b64EncodeData;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 90, "test_b64DecodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeString(); }
+} testDescription_Base64TestSuite_test_b64DecodeString;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 98, "test_b64DecodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeStream(); }
+} testDescription_Base64TestSuite_test_b64DecodeStream;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 114, "test_b64DecodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeData(); }
+} testDescription_Base64TestSuite_test_b64DecodeData;
+
+#include "test/common/bitstream.h"
+
+static BitStreamTestSuite suite_BitStreamTestSuite;
+
+static CxxTest::List Tests_BitStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BitStreamTestSuite( "test/common/bitstream.h", 6, "BitStreamTestSuite", suite_BitStreamTestSuite, Tests_BitStreamTestSuite );
+
+static class TestDescription_BitStreamTestSuite_test_get_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 24, "test_get_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bit(); }
+} testDescription_BitStreamTestSuite_test_get_bit;
+
+static class TestDescription_BitStreamTestSuite_test_get_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 45, "test_get_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits(); }
+} testDescription_BitStreamTestSuite_test_get_bits;
+
+static class TestDescription_BitStreamTestSuite_test_skip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_skip() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 69, "test_skip" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_skip(); }
+} testDescription_BitStreamTestSuite_test_skip;
+
+static class TestDescription_BitStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 93, "test_rewind" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_rewind(); }
+} testDescription_BitStreamTestSuite_test_rewind;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 116, "test_peek_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bit(); }
+} testDescription_BitStreamTestSuite_test_peek_bit;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 142, "test_peek_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits(); }
+} testDescription_BitStreamTestSuite_test_peek_bits;
+
+static class TestDescription_BitStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 165, "test_eos" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_eos(); }
+} testDescription_BitStreamTestSuite_test_eos;
+
+static class TestDescription_BitStreamTestSuite_test_get_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 186, "test_get_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits_lsb(); }
+} testDescription_BitStreamTestSuite_test_get_bits_lsb;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 212, "test_peek_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits_lsb(); }
+} testDescription_BitStreamTestSuite_test_peek_bits_lsb;
+
+static class TestDescription_BitStreamTestSuite_test_align : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_align() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 233, "test_align" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align(); }
+} testDescription_BitStreamTestSuite_test_align;
+
+static class TestDescription_BitStreamTestSuite_test_align_16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_align_16() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 254, "test_align_16" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align_16(); }
+} testDescription_BitStreamTestSuite_test_align_16;
+
+#include "test/common/bufferedreadstream.h"
+
+static BufferedReadStreamTestSuite suite_BufferedReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedReadStreamTestSuite( "test/common/bufferedreadstream.h", 6, "BufferedReadStreamTestSuite", suite_BufferedReadStreamTestSuite, Tests_BufferedReadStreamTestSuite );
+
+static class TestDescription_BufferedReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse(); }
+} testDescription_BufferedReadStreamTestSuite_test_traverse;
+
+static class TestDescription_BufferedReadStreamTestSuite_test_traverse2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedReadStreamTestSuite_test_traverse2() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 34, "test_traverse2" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse2(); }
+} testDescription_BufferedReadStreamTestSuite_test_traverse2;
+
+#include "test/common/bufferedseekablereadstream.h"
+
+static BufferedSeekableReadStreamTestSuite suite_BufferedSeekableReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedSeekableReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedSeekableReadStreamTestSuite( "test/common/bufferedseekablereadstream.h", 6, "BufferedSeekableReadStreamTestSuite", suite_BufferedSeekableReadStreamTestSuite, Tests_BufferedSeekableReadStreamTestSuite );
+
+static class TestDescription_BufferedSeekableReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedSeekableReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_traverse(); }
+} testDescription_BufferedSeekableReadStreamTestSuite_test_traverse;
+
+static class TestDescription_BufferedSeekableReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedSeekableReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 33, "test_seek" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_seek(); }
+} testDescription_BufferedSeekableReadStreamTestSuite_test_seek;
+
+#include "test/common/crc.h"
+
+static CrcTestSuite suite_CrcTestSuite;
+
+static CxxTest::List Tests_CrcTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CrcTestSuite( "test/common/crc.h", 22, "CrcTestSuite", suite_CrcTestSuite, Tests_CrcTestSuite );
+
+static class TestDescription_CrcTestSuite_test_crc32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 25, "test_crc32" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32(); }
+} testDescription_CrcTestSuite_test_crc32;
+
+static class TestDescription_CrcTestSuite_test_crc32_block : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32_block() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 35, "test_crc32_block" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32_block(); }
+} testDescription_CrcTestSuite_test_crc32_block;
+
+static class TestDescription_CrcTestSuite_test_crc32_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32_speed() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 59, "test_crc32_speed" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32_speed(); }
+} testDescription_CrcTestSuite_test_crc32_speed;
+
+static class TestDescription_CrcTestSuite_test_crc16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc16() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 90, "test_crc16" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16(); }
+} testDescription_CrcTestSuite_test_crc16;
+
+static class TestDescription_CrcTestSuite_test_crc_ccitt : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_ccitt() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 100, "test_crc_ccitt" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt(); }
+} testDescription_CrcTestSuite_test_crc_ccitt;
+
+static class TestDescription_CrcTestSuite_test_crc_binhex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_binhex() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 110, "test_crc_binhex" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex(); }
+} testDescription_CrcTestSuite_test_crc_binhex;
+
+static class TestDescription_CrcTestSuite_test_crc32_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 120, "test_crc32_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32_slow(); }
+} testDescription_CrcTestSuite_test_crc32_slow;
+
+static class TestDescription_CrcTestSuite_test_crc16_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc16_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 125, "test_crc16_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16_slow(); }
+} testDescription_CrcTestSuite_test_crc16_slow;
+
+static class TestDescription_CrcTestSuite_test_crc_ccitt_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_ccitt_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 130, "test_crc_ccitt_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt_slow(); }
+} testDescription_CrcTestSuite_test_crc_ccitt_slow;
+
+static class TestDescription_CrcTestSuite_test_crc_binhex_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_binhex_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 135, "test_crc_binhex_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex_slow(); }
+} testDescription_CrcTestSuite_test_crc_binhex_slow;
+
+#include "test/common/encoding.h"
+
+static EncodingTestSuite suite_EncodingTestSuite;
+
+static CxxTest::List Tests_EncodingTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EncodingTestSuite( "test/common/encoding.h", 15, "EncodingTestSuite", suite_EncodingTestSuite, Tests_EncodingTestSuite );
+
+static class TestDescription_EncodingTestSuite_test_korean : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_korean() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 18, "test_korean" ) {}
+ void runTest() { suite_EncodingTestSuite.test_korean(); }
+} testDescription_EncodingTestSuite_test_korean;
+
+static class TestDescription_EncodingTestSuite_test_chinese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_chinese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 59, "test_chinese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_chinese(); }
+} testDescription_EncodingTestSuite_test_chinese;
+
+static class TestDescription_EncodingTestSuite_test_japanese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_japanese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 95, "test_japanese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_japanese(); }
+} testDescription_EncodingTestSuite_test_japanese;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_machine_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_machine_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 140, "test_conversion_unicode_machine_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_machine_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_machine_endian;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_big_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_big_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 194, "test_conversion_unicode_big_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_big_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_big_endian;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_little_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_little_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 214, "test_conversion_unicode_little_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_little_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_little_endian;
+
+static class TestDescription_EncodingTestSuite_test_cyrillic_transliteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_cyrillic_transliteration() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 233, "test_cyrillic_transliteration" ) {}
+ void runTest() { suite_EncodingTestSuite.test_cyrillic_transliteration(); }
+} testDescription_EncodingTestSuite_test_cyrillic_transliteration;
+
+static class TestDescription_EncodingTestSuite_test_other_conversions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_other_conversions() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 255, "test_other_conversions" ) {}
+ void runTest() { suite_EncodingTestSuite.test_other_conversions(); }
+} testDescription_EncodingTestSuite_test_other_conversions;
+
+#include "test/common/endian.h"
+
+static EndianTestSuite suite_EndianTestSuite;
+
+static CxxTest::List Tests_EndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EndianTestSuite( "test/common/endian.h", 4, "EndianTestSuite", suite_EndianTestSuite, Tests_EndianTestSuite );
+
+static class TestDescription_EndianTestSuite_test_MKTAG : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_MKTAG() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 7, "test_MKTAG" ) {}
+ void runTest() { suite_EndianTestSuite.test_MKTAG(); }
+} testDescription_EndianTestSuite_test_MKTAG;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 13, "test_READ_BE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT64(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT64;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 19, "test_READ_LE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT64(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT64;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 25, "test_READ_BE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT32(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT32;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 31, "test_READ_LE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT32(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT32;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 37, "test_READ_BE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT16(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT16;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 43, "test_READ_LE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT16(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT16;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 49, "test_READ_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_READ_BE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 55, "test_READ_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_READ_LE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 61, "test_READ_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_BE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 67, "test_READ_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_LE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_READ_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 73, "test_READ_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_FPA_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_FPA_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 79, "test_WRITE_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_WRITE_BE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 86, "test_WRITE_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_WRITE_LE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 93, "test_WRITE_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_BE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 100, "test_WRITE_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_LE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 107, "test_WRITE_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_FPA_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64;
+
+#include "test/common/fixedstack.h"
+
+static FixedStackTestSuite suite_FixedStackTestSuite;
+
+static CxxTest::List Tests_FixedStackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedStackTestSuite( "test/common/fixedstack.h", 5, "FixedStackTestSuite", suite_FixedStackTestSuite, Tests_FixedStackTestSuite );
+
+static class TestDescription_FixedStackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_empty_clear(); }
+} testDescription_FixedStackTestSuite_test_empty_clear;
+
+static class TestDescription_FixedStackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_size(); }
+} testDescription_FixedStackTestSuite_test_size;
+
+static class TestDescription_FixedStackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_top_pop(); }
+} testDescription_FixedStackTestSuite_test_top_pop;
+
+static class TestDescription_FixedStackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_assign(); }
+} testDescription_FixedStackTestSuite_test_assign;
+
+#include "test/common/func.h"
+
+static FuncTestSuite suite_FuncTestSuite;
+
+static CxxTest::List Tests_FuncTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FuncTestSuite( "test/common/func.h", 8, "FuncTestSuite", suite_FuncTestSuite, Tests_FuncTestSuite );
+
+static class TestDescription_FuncTestSuite_test_bind1st : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_bind1st() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 11, "test_bind1st" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind1st(); }
+} testDescription_FuncTestSuite_test_bind1st;
+
+static class TestDescription_FuncTestSuite_test_bind2nd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_bind2nd() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 17, "test_bind2nd" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind2nd(); }
+} testDescription_FuncTestSuite_test_bind2nd;
+
+static class TestDescription_FuncTestSuite_test_mem_fun_ref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_mem_fun_ref() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 33, "test_mem_fun_ref" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun_ref(); }
+} testDescription_FuncTestSuite_test_mem_fun_ref;
+
+static class TestDescription_FuncTestSuite_test_mem_fun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_mem_fun() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 44, "test_mem_fun" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun(); }
+} testDescription_FuncTestSuite_test_mem_fun;
+
+#include "test/common/hash-str.h"
+
+static HashStrTestSuite suite_HashStrTestSuite;
+
+static CxxTest::List Tests_HashStrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashStrTestSuite( "test/common/hash-str.h", 10, "HashStrTestSuite", suite_HashStrTestSuite, Tests_HashStrTestSuite );
+
+static class TestDescription_HashStrTestSuite_test_case_sensitive_string_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_case_sensitive_string_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 13, "test_case_sensitive_string_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_equal_to(); }
+} testDescription_HashStrTestSuite_test_case_sensitive_string_equal_to;
+
+static class TestDescription_HashStrTestSuite_test_ignore_case_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_ignore_case_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 45, "test_ignore_case_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_equal_to(); }
+} testDescription_HashStrTestSuite_test_ignore_case_equal_to;
+
+static class TestDescription_HashStrTestSuite_test_case_sensitive_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_case_sensitive_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 76, "test_case_sensitive_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_hash(); }
+} testDescription_HashStrTestSuite_test_case_sensitive_string_hash;
+
+static class TestDescription_HashStrTestSuite_test_ignore_case_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_ignore_case_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 98, "test_ignore_case_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_hash(); }
+} testDescription_HashStrTestSuite_test_ignore_case_hash;
+
+static class TestDescription_HashStrTestSuite_test_cpp_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_cpp_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 116, "test_cpp_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_cpp_string_hash(); }
+} testDescription_HashStrTestSuite_test_cpp_string_hash;
+
+static class TestDescription_HashStrTestSuite_test_c_style_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_c_style_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 138, "test_c_style_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_c_style_string_hash(); }
+} testDescription_HashStrTestSuite_test_c_style_string_hash;
+
+#include "test/common/hashmap.h"
+
+static HashMapTestSuite suite_HashMapTestSuite;
+
+static CxxTest::List Tests_HashMapTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashMapTestSuite( "test/common/hashmap.h", 6, "HashMapTestSuite", suite_HashMapTestSuite, Tests_HashMapTestSuite );
+
+static class TestDescription_HashMapTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 9, "test_empty_clear" ) {}
+ void runTest() { suite_HashMapTestSuite.test_empty_clear(); }
+} testDescription_HashMapTestSuite_test_empty_clear;
+
+static class TestDescription_HashMapTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 27, "test_contains" ) {}
+ void runTest() { suite_HashMapTestSuite.test_contains(); }
+} testDescription_HashMapTestSuite_test_contains;
+
+static class TestDescription_HashMapTestSuite_test_add_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_add_remove() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 45, "test_add_remove" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove(); }
+} testDescription_HashMapTestSuite_test_add_remove;
+
+static class TestDescription_HashMapTestSuite_test_add_remove_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_add_remove_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 74, "test_add_remove_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove_iterator(); }
+} testDescription_HashMapTestSuite_test_add_remove_iterator;
+
+static class TestDescription_HashMapTestSuite_test_lookup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_lookup() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 103, "test_lookup" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup(); }
+} testDescription_HashMapTestSuite_test_lookup;
+
+static class TestDescription_HashMapTestSuite_test_lookup_with_default : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_lookup_with_default() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 118, "test_lookup_with_default" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup_with_default(); }
+} testDescription_HashMapTestSuite_test_lookup_with_default;
+
+static class TestDescription_HashMapTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 136, "test_iterator_begin_end" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator_begin_end(); }
+} testDescription_HashMapTestSuite_test_iterator_begin_end;
+
+static class TestDescription_HashMapTestSuite_test_hash_map_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_hash_map_copy() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 151, "test_hash_map_copy" ) {}
+ void runTest() { suite_HashMapTestSuite.test_hash_map_copy(); }
+} testDescription_HashMapTestSuite_test_hash_map_copy;
+
+static class TestDescription_HashMapTestSuite_test_collision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_collision() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 158, "test_collision" ) {}
+ void runTest() { suite_HashMapTestSuite.test_collision(); }
+} testDescription_HashMapTestSuite_test_collision;
+
+static class TestDescription_HashMapTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 200, "test_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator(); }
+} testDescription_HashMapTestSuite_test_iterator;
+
+#include "test/common/ini-file.h"
+
+static IniFileTestSuite suite_IniFileTestSuite;
+
+static CxxTest::List Tests_IniFileTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IniFileTestSuite( "test/common/ini-file.h", 7, "IniFileTestSuite", suite_IniFileTestSuite, Tests_IniFileTestSuite );
+
+static class TestDescription_IniFileTestSuite_test_blank_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_blank_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 9, "test_blank_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_blank_ini_file(); }
+} testDescription_IniFileTestSuite_test_blank_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 18, "test_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_simple_ini_file(); }
+} testDescription_IniFileTestSuite_test_simple_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_multisection_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_multisection_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 41, "test_multisection_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_multisection_ini_file(); }
+} testDescription_IniFileTestSuite_test_multisection_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_modify_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_modify_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 69, "test_modify_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_modify_ini_file(); }
+} testDescription_IniFileTestSuite_test_modify_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_name_validity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_name_validity() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 93, "test_name_validity" ) {}
+ void runTest() { suite_IniFileTestSuite.test_name_validity(); }
+} testDescription_IniFileTestSuite_test_name_validity;
+
+static class TestDescription_IniFileTestSuite_test_write_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_write_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 126, "test_write_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_write_simple_ini_file(); }
+} testDescription_IniFileTestSuite_test_write_simple_ini_file;
+
+#include "test/common/intrinsics.h"
+
+static IntrinsicsTestSuite suite_IntrinsicsTestSuite;
+
+static CxxTest::List Tests_IntrinsicsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IntrinsicsTestSuite( "test/common/intrinsics.h", 5, "IntrinsicsTestSuite", suite_IntrinsicsTestSuite, Tests_IntrinsicsTestSuite );
+
+static class TestDescription_IntrinsicsTestSuite_test_intLog2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IntrinsicsTestSuite_test_intLog2() : CxxTest::RealTestDescription( Tests_IntrinsicsTestSuite, suiteDescription_IntrinsicsTestSuite, 8, "test_intLog2" ) {}
+ void runTest() { suite_IntrinsicsTestSuite.test_intLog2(); }
+} testDescription_IntrinsicsTestSuite_test_intLog2;
+
+#include "test/common/list.h"
+
+static ListTestSuite suite_ListTestSuite;
+
+static CxxTest::List Tests_ListTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ListTestSuite( "test/common/list.h", 5, "ListTestSuite", suite_ListTestSuite, Tests_ListTestSuite );
+
+static class TestDescription_ListTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 8, "test_empty_clear" ) {}
+ void runTest() { suite_ListTestSuite.test_empty_clear(); }
+} testDescription_ListTestSuite_test_empty_clear;
+
+static class TestDescription_ListTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_size() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 19, "test_size" ) {}
+ void runTest() { suite_ListTestSuite.test_size(); }
+} testDescription_ListTestSuite_test_size;
+
+static class TestDescription_ListTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 30, "test_iterator_begin_end" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator_begin_end(); }
+} testDescription_ListTestSuite_test_iterator_begin_end;
+
+static class TestDescription_ListTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 45, "test_iterator" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator(); }
+} testDescription_ListTestSuite_test_iterator;
+
+static class TestDescription_ListTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 89, "test_insert" ) {}
+ void runTest() { suite_ListTestSuite.test_insert(); }
+} testDescription_ListTestSuite_test_insert;
+
+static class TestDescription_ListTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 141, "test_erase" ) {}
+ void runTest() { suite_ListTestSuite.test_erase(); }
+} testDescription_ListTestSuite_test_erase;
+
+static class TestDescription_ListTestSuite_test_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_remove() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 181, "test_remove" ) {}
+ void runTest() { suite_ListTestSuite.test_remove(); }
+} testDescription_ListTestSuite_test_remove;
+
+static class TestDescription_ListTestSuite_test_reverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_reverse() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 217, "test_reverse" ) {}
+ void runTest() { suite_ListTestSuite.test_reverse(); }
+} testDescription_ListTestSuite_test_reverse;
+
+static class TestDescription_ListTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 259, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ListTestSuite.test_front_back_push_pop(); }
+} testDescription_ListTestSuite_test_front_back_push_pop;
+
+#include "test/common/md5.h"
+
+static MD5TestSuite suite_MD5TestSuite;
+
+static CxxTest::List Tests_MD5TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MD5TestSuite( "test/common/md5.h", 42, "MD5TestSuite", suite_MD5TestSuite, Tests_MD5TestSuite );
+
+static class TestDescription_MD5TestSuite_test_computeStreamMD5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MD5TestSuite_test_computeStreamMD5() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 44, "test_computeStreamMD5" ) {}
+ void runTest() { suite_MD5TestSuite.test_computeStreamMD5(); }
+} testDescription_MD5TestSuite_test_computeStreamMD5;
+
+static class TestDescription_MD5TestSuite_test_incremental : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MD5TestSuite_test_incremental() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 62, "test_incremental" ) {}
+ void runTest() { suite_MD5TestSuite.test_incremental(); }
+} testDescription_MD5TestSuite_test_incremental;
+
+static class TestDescription_MD5TestSuite_test_computeStreamsMD5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MD5TestSuite_test_computeStreamsMD5() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 81, "test_computeStreamsMD5" ) {}
+ void runTest() { suite_MD5TestSuite.test_computeStreamsMD5(); }
+} testDescription_MD5TestSuite_test_computeStreamsMD5;
+
+static class TestDescription_MD5TestSuite_test_md5_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MD5TestSuite_test_md5_speed() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 125, "test_md5_speed" ) {}
+ void runTest() { suite_MD5TestSuite.test_md5_speed(); }
+} testDescription_MD5TestSuite_test_md5_speed;
+
+#include "test/common/memory.h"
+
+static MemoryTestSuite suite_MemoryTestSuite;
+
+static CxxTest::List Tests_MemoryTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryTestSuite( "test/common/memory.h", 5, "MemoryTestSuite", suite_MemoryTestSuite, Tests_MemoryTestSuite );
+
+static class TestDescription_MemoryTestSuite_test_memset16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset16() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 7, "test_memset16" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset16(); }
+} testDescription_MemoryTestSuite_test_memset16;
+
+static class TestDescription_MemoryTestSuite_test_memset32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset32() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 26, "test_memset32" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset32(); }
+} testDescription_MemoryTestSuite_test_memset32;
+
+static class TestDescription_MemoryTestSuite_test_memset64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset64() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 45, "test_memset64" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset64(); }
+} testDescription_MemoryTestSuite_test_memset64;
+
+#include "test/common/memoryreadstream.h"
+
+static MemoryReadStreamTestSuite suite_MemoryReadStreamTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamTestSuite( "test/common/memoryreadstream.h", 5, "MemoryReadStreamTestSuite", suite_MemoryReadStreamTestSuite, Tests_MemoryReadStreamTestSuite );
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_set(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_set;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_cur(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_cur;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_end(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_end;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_le(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_read_le;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_be(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_read_be;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 92, "test_eos" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_eos(); }
+} testDescription_MemoryReadStreamTestSuite_test_eos;
+
+#include "test/common/memoryreadstreamendian.h"
+
+static MemoryReadStreamEndianTestSuite suite_MemoryReadStreamEndianTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamEndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamEndianTestSuite( "test/common/memoryreadstreamendian.h", 5, "MemoryReadStreamEndianTestSuite", suite_MemoryReadStreamEndianTestSuite, Tests_MemoryReadStreamEndianTestSuite );
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_set(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_set;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_cur(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_cur;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_end(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_end;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 92, "test_seek_read_le2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le2(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 107, "test_seek_read_be2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be2(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2;
+
+#include "test/common/memorywritestream.h"
+
+static MemoryWriteStreamTestSuite suite_MemoryWriteStreamTestSuite;
+
+static CxxTest::List Tests_MemoryWriteStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryWriteStreamTestSuite( "test/common/memorywritestream.h", 5, "MemoryWriteStreamTestSuite", suite_MemoryWriteStreamTestSuite, Tests_MemoryWriteStreamTestSuite );
+
+static class TestDescription_MemoryWriteStreamTestSuite_test_err : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryWriteStreamTestSuite_test_err() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 7, "test_err" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_err(); }
+} testDescription_MemoryWriteStreamTestSuite_test_err;
+
+static class TestDescription_MemoryWriteStreamTestSuite_test_write : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryWriteStreamTestSuite_test_write() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 22, "test_write" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_write(); }
+} testDescription_MemoryWriteStreamTestSuite_test_write;
+
+#include "test/common/pack.h"
+
+static PackTestSuite suite_PackTestSuite;
+
+static CxxTest::List Tests_PackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PackTestSuite( "test/common/pack.h", 20, "PackTestSuite", suite_PackTestSuite, Tests_PackTestSuite );
+
+static class TestDescription_PackTestSuite_test_packing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PackTestSuite_test_packing() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 23, "test_packing" ) {}
+ void runTest() { suite_PackTestSuite.test_packing(); }
+} testDescription_PackTestSuite_test_packing;
+
+static class TestDescription_PackTestSuite_test_offsets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PackTestSuite_test_offsets() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 27, "test_offsets" ) {}
+ void runTest() { suite_PackTestSuite.test_offsets(); }
+} testDescription_PackTestSuite_test_offsets;
+
+#include "test/common/path.h"
+
+static PathTestSuite suite_PathTestSuite;
+
+static CxxTest::List Tests_PathTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PathTestSuite( "test/common/path.h", 13, "PathTestSuite", suite_PathTestSuite, Tests_PathTestSuite );
+
+static class TestDescription_PathTestSuite_test_Path : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_Path() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 16, "test_Path" ) {}
+ void runTest() { suite_PathTestSuite.test_Path(); }
+} testDescription_PathTestSuite_test_Path;
+
+static class TestDescription_PathTestSuite_test_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_clear() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 55, "test_clear" ) {}
+ void runTest() { suite_PathTestSuite.test_clear(); }
+} testDescription_PathTestSuite_test_clear;
+
+static class TestDescription_PathTestSuite_test_getLastComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_getLastComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 66, "test_getLastComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_getLastComponent(); }
+} testDescription_PathTestSuite_test_getLastComponent;
+
+static class TestDescription_PathTestSuite_test_baseName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_baseName() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 80, "test_baseName" ) {}
+ void runTest() { suite_PathTestSuite.test_baseName(); }
+} testDescription_PathTestSuite_test_baseName;
+
+static class TestDescription_PathTestSuite_test_getParent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_getParent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 97, "test_getParent" ) {}
+ void runTest() { suite_PathTestSuite.test_getParent(); }
+} testDescription_PathTestSuite_test_getParent;
+
+static class TestDescription_PathTestSuite_test_join : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_join() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 117, "test_join" ) {}
+ void runTest() { suite_PathTestSuite.test_join(); }
+} testDescription_PathTestSuite_test_join;
+
+static class TestDescription_PathTestSuite_test_joinInPlace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_joinInPlace() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 156, "test_joinInPlace" ) {}
+ void runTest() { suite_PathTestSuite.test_joinInPlace(); }
+} testDescription_PathTestSuite_test_joinInPlace;
+
+static class TestDescription_PathTestSuite_test_append : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_append() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 178, "test_append" ) {}
+ void runTest() { suite_PathTestSuite.test_append(); }
+} testDescription_PathTestSuite_test_append;
+
+static class TestDescription_PathTestSuite_test_appendComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_appendComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 200, "test_appendComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_appendComponent(); }
+} testDescription_PathTestSuite_test_appendComponent;
+
+static class TestDescription_PathTestSuite_test_separator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_separator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 220, "test_separator" ) {}
+ void runTest() { suite_PathTestSuite.test_separator(); }
+} testDescription_PathTestSuite_test_separator;
+
+static class TestDescription_PathTestSuite_test_splitComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_splitComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 231, "test_splitComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_splitComponents(); }
+} testDescription_PathTestSuite_test_splitComponents;
+
+static class TestDescription_PathTestSuite_test_joinComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_joinComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 266, "test_joinComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_joinComponents(); }
+} testDescription_PathTestSuite_test_joinComponents;
+
+static class TestDescription_PathTestSuite_test_removeTrailingSeparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_removeTrailingSeparators() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 283, "test_removeTrailingSeparators" ) {}
+ void runTest() { suite_PathTestSuite.test_removeTrailingSeparators(); }
+} testDescription_PathTestSuite_test_removeTrailingSeparators;
+
+static class TestDescription_PathTestSuite_test_isRelativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_isRelativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 301, "test_isRelativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_isRelativeTo(); }
+} testDescription_PathTestSuite_test_isRelativeTo;
+
+static class TestDescription_PathTestSuite_test_relativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_relativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 330, "test_relativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_relativeTo(); }
+} testDescription_PathTestSuite_test_relativeTo;
+
+static class TestDescription_PathTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 362, "test_normalize" ) {}
+ void runTest() { suite_PathTestSuite.test_normalize(); }
+} testDescription_PathTestSuite_test_normalize;
+
+static class TestDescription_PathTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 396, "test_punycode" ) {}
+ void runTest() { suite_PathTestSuite.test_punycode(); }
+} testDescription_PathTestSuite_test_punycode;
+
+static class TestDescription_PathTestSuite_test_lowerupper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_lowerupper() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 429, "test_lowerupper" ) {}
+ void runTest() { suite_PathTestSuite.test_lowerupper(); }
+} testDescription_PathTestSuite_test_lowerupper;
+
+static class TestDescription_PathTestSuite_test_caseinsensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_caseinsensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 449, "test_caseinsensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_caseinsensitive(); }
+} testDescription_PathTestSuite_test_caseinsensitive;
+
+static class TestDescription_PathTestSuite_test_casesensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_casesensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 470, "test_casesensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_casesensitive(); }
+} testDescription_PathTestSuite_test_casesensitive;
+
+static class TestDescription_PathTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 480, "test_matchString" ) {}
+ void runTest() { suite_PathTestSuite.test_matchString(); }
+} testDescription_PathTestSuite_test_matchString;
+
+static class TestDescription_PathTestSuite_test_findLastSeparator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_findLastSeparator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 521, "test_findLastSeparator" ) {}
+ void runTest() { suite_PathTestSuite.test_findLastSeparator(); }
+} testDescription_PathTestSuite_test_findLastSeparator;
+
+static class TestDescription_PathTestSuite_test_extract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_extract() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 529, "test_extract" ) {}
+ void runTest() { suite_PathTestSuite.test_extract(); }
+} testDescription_PathTestSuite_test_extract;
+
+static class TestDescription_PathTestSuite_test_canUnescape : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_canUnescape() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 538, "test_canUnescape" ) {}
+ void runTest() { suite_PathTestSuite.test_canUnescape(); }
+} testDescription_PathTestSuite_test_canUnescape;
+
+static class TestDescription_PathTestSuite_test_removeExtension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_removeExtension() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 542, "test_removeExtension" ) {}
+ void runTest() { suite_PathTestSuite.test_removeExtension(); }
+} testDescription_PathTestSuite_test_removeExtension;
+
+#include "test/common/profiler.h"
+
+static ProfilerTestSuite suite_ProfilerTestSuite;
+
+static CxxTest::List Tests_ProfilerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ProfilerTestSuite( "test/common/profiler.h", 8, "ProfilerTestSuite", suite_ProfilerTestSuite, Tests_ProfilerTestSuite );
+
+static class TestDescription_ProfilerTestSuite_test_frame_stats : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ProfilerTestSuite_test_frame_stats() : CxxTest::RealTestDescription( Tests_ProfilerTestSuite, suiteDescription_ProfilerTestSuite, 10, "test_frame_stats" ) {}
+ void runTest() { suite_ProfilerTestSuite.test_frame_stats(); }
+} testDescription_ProfilerTestSuite_test_frame_stats;
+
+static class TestDescription_ProfilerTestSuite_test_chrome_trace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ProfilerTestSuite_test_chrome_trace() : CxxTest::RealTestDescription( Tests_ProfilerTestSuite, suiteDescription_ProfilerTestSuite, 45, "test_chrome_trace" ) {}
+ void runTest() { suite_ProfilerTestSuite.test_chrome_trace(); }
+} testDescription_ProfilerTestSuite_test_chrome_trace;
+
+#include "test/common/ptr.h"
+
+static PtrTestSuite suite_PtrTestSuite;
+
+static CxxTest::List Tests_PtrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PtrTestSuite( "test/common/ptr.h", 5, "PtrTestSuite", suite_PtrTestSuite, Tests_PtrTestSuite );
+
+static class TestDescription_PtrTestSuite_test_deletion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_deletion() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 25, "test_deletion" ) {}
+ void runTest() { suite_PtrTestSuite.test_deletion(); }
+} testDescription_PtrTestSuite_test_deletion;
+
+static class TestDescription_PtrTestSuite_test_scoped_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_scoped_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 45, "test_scoped_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deleter(); }
+} testDescription_PtrTestSuite_test_scoped_deleter;
+
+static class TestDescription_PtrTestSuite_test_disposable_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_disposable_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 56, "test_disposable_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deleter(); }
+} testDescription_PtrTestSuite_test_disposable_deleter;
+
+static class TestDescription_PtrTestSuite_test_scoped_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_scoped_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 76, "test_scoped_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deref(); }
+} testDescription_PtrTestSuite_test_scoped_deref;
+
+static class TestDescription_PtrTestSuite_test_disposable_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_disposable_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 84, "test_disposable_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deref(); }
+} testDescription_PtrTestSuite_test_disposable_deref;
+
+static class TestDescription_PtrTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 92, "test_assign" ) {}
+ void runTest() { suite_PtrTestSuite.test_assign(); }
+} testDescription_PtrTestSuite_test_assign;
+
+static class TestDescription_PtrTestSuite_test_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 128, "test_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_deleter(); }
+} testDescription_PtrTestSuite_test_deleter;
+
+static class TestDescription_PtrTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 140, "test_compare" ) {}
+ void runTest() { suite_PtrTestSuite.test_compare(); }
+} testDescription_PtrTestSuite_test_compare;
+
+static class TestDescription_PtrTestSuite_test_cast : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_cast() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 154, "test_cast" ) {}
+ void runTest() { suite_PtrTestSuite.test_cast(); }
+} testDescription_PtrTestSuite_test_cast;
+
+static class TestDescription_PtrTestSuite_test_weak_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_weak_ptr() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 160, "test_weak_ptr" ) {}
+ void runTest() { suite_PtrTestSuite.test_weak_ptr(); }
+} testDescription_PtrTestSuite_test_weak_ptr;
+
+#include "test/common/punycode.h"
+
+static PunycodeTestSuite suite_PunycodeTestSuite;
+
+static CxxTest::List Tests_PunycodeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PunycodeTestSuite( "test/common/punycode.h", 28, "PunycodeTestSuite", suite_PunycodeTestSuite, Tests_PunycodeTestSuite );
+
+static class TestDescription_PunycodeTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PunycodeTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PunycodeTestSuite, suiteDescription_PunycodeTestSuite, 31, "test_punycode" ) {}
+ void runTest() { suite_PunycodeTestSuite.test_punycode(); }
+} testDescription_PunycodeTestSuite_test_punycode;
+
+#include "test/common/queue.h"
+
+static QueueTestSuite suite_QueueTestSuite;
+
+static CxxTest::List Tests_QueueTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QueueTestSuite( "test/common/queue.h", 5, "QueueTestSuite", suite_QueueTestSuite, Tests_QueueTestSuite );
+
+static class TestDescription_QueueTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_QueueTestSuite.test_empty_clear(); }
+} testDescription_QueueTestSuite_test_empty_clear;
+
+static class TestDescription_QueueTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_size() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_QueueTestSuite.test_size(); }
+} testDescription_QueueTestSuite_test_size;
+
+static class TestDescription_QueueTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 35, "test_front_back_push_pop" ) {}
+ void runTest() { suite_QueueTestSuite.test_front_back_push_pop(); }
+} testDescription_QueueTestSuite_test_front_back_push_pop;
+
+static class TestDescription_QueueTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 54, "test_assign" ) {}
+ void runTest() { suite_QueueTestSuite.test_assign(); }
+} testDescription_QueueTestSuite_test_assign;
+
+#include "test/common/rational.h"
+
+static RationalTestSuite suite_RationalTestSuite;
+
+static CxxTest::List Tests_RationalTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RationalTestSuite( "test/common/rational.h", 5, "RationalTestSuite", suite_RationalTestSuite, Tests_RationalTestSuite );
+
+static class TestDescription_RationalTestSuite_test_operators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_operators() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 7, "test_operators" ) {}
+ void runTest() { suite_RationalTestSuite.test_operators(); }
+} testDescription_RationalTestSuite_test_operators;
+
+static class TestDescription_RationalTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 48, "test_assign" ) {}
+ void runTest() { suite_RationalTestSuite.test_assign(); }
+} testDescription_RationalTestSuite_test_assign;
+
+static class TestDescription_RationalTestSuite_test_negative : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_negative() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 60, "test_negative" ) {}
+ void runTest() { suite_RationalTestSuite.test_negative(); }
+} testDescription_RationalTestSuite_test_negative;
+
+static class TestDescription_RationalTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 74, "test_add_sub" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub(); }
+} testDescription_RationalTestSuite_test_add_sub;
+
+static class TestDescription_RationalTestSuite_test_add_sub2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_add_sub2() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 89, "test_add_sub2" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub2(); }
+} testDescription_RationalTestSuite_test_add_sub2;
+
+static class TestDescription_RationalTestSuite_test_mul : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_mul() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 105, "test_mul" ) {}
+ void runTest() { suite_RationalTestSuite.test_mul(); }
+} testDescription_RationalTestSuite_test_mul;
+
+static class TestDescription_RationalTestSuite_test_div : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_div() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 124, "test_div" ) {}
+ void runTest() { suite_RationalTestSuite.test_div(); }
+} testDescription_RationalTestSuite_test_div;
+
+static class TestDescription_RationalTestSuite_test_isOne : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_isOne() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 134, "test_isOne" ) {}
+ void runTest() { suite_RationalTestSuite.test_isOne(); }
+} testDescription_RationalTestSuite_test_isOne;
+
+#include "test/common/rect.h"
+
+static RectTestSuite suite_RectTestSuite;
+
+static CxxTest::List Tests_RectTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RectTestSuite( "test/common/rect.h", 5, "RectTestSuite", suite_RectTestSuite, Tests_RectTestSuite );
+
+static class TestDescription_RectTestSuite_test_point_sqrDist : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_point_sqrDist() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 8, "test_point_sqrDist" ) {}
+ void runTest() { suite_RectTestSuite.test_point_sqrDist(); }
+} testDescription_RectTestSuite_test_point_sqrDist;
+
+static class TestDescription_RectTestSuite_test_intersects : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_intersects() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 21, "test_intersects" ) {}
+ void runTest() { suite_RectTestSuite.test_intersects(); }
+} testDescription_RectTestSuite_test_intersects;
+
+static class TestDescription_RectTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 27, "test_contains" ) {}
+ void runTest() { suite_RectTestSuite.test_contains(); }
+} testDescription_RectTestSuite_test_contains;
+
+static class TestDescription_RectTestSuite_test_extend : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_extend() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 44, "test_extend" ) {}
+ void runTest() { suite_RectTestSuite.test_extend(); }
+} testDescription_RectTestSuite_test_extend;
+
+#include "test/common/region.h"
+
+static RegionTestSuite suite_RegionTestSuite;
+
+static CxxTest::List Tests_RegionTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionTestSuite( "test/common/region.h", 5, "RegionTestSuite", suite_RegionTestSuite, Tests_RegionTestSuite );
+
+static class TestDescription_RegionTestSuite_test_unite : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RegionTestSuite_test_unite() : CxxTest::RealTestDescription( Tests_RegionTestSuite, suiteDescription_RegionTestSuite, 41, "test_unite" ) {}
+ void runTest() { suite_RegionTestSuite.test_unite(); }
+} testDescription_RegionTestSuite_test_unite;
+
+static class TestDescription_RegionTestSuite_test_intersect_subtract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RegionTestSuite_test_intersect_subtract() : CxxTest::RealTestDescription( Tests_RegionTestSuite, suiteDescription_RegionTestSuite, 60, "test_intersect_subtract" ) {}
+ void runTest() { suite_RegionTestSuite.test_intersect_subtract(); }
+} testDescription_RegionTestSuite_test_intersect_subtract;
+
+static class TestDescription_RegionTestSuite_test_simplify : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RegionTestSuite_test_simplify() : CxxTest::RealTestDescription( Tests_RegionTestSuite, suiteDescription_RegionTestSuite, 77, "test_simplify" ) {}
+ void runTest() { suite_RegionTestSuite.test_simplify(); }
+} testDescription_RegionTestSuite_test_simplify;
+
+static class TestDescription_RegionTestSuite_test_random_operations : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RegionTestSuite_test_random_operations() : CxxTest::RealTestDescription( Tests_RegionTestSuite, suiteDescription_RegionTestSuite, 90, "test_random_operations" ) {}
+ void runTest() { suite_RegionTestSuite.test_random_operations(); }
+} testDescription_RegionTestSuite_test_random_operations;
+
+#include "test/common/rendermode.h"
+
+static RenderModeTestSuite suite_RenderModeTestSuite;
+
+static CxxTest::List Tests_RenderModeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RenderModeTestSuite( "test/common/rendermode.h", 6, "RenderModeTestSuite", suite_RenderModeTestSuite, Tests_RenderModeTestSuite );
+
+static class TestDescription_RenderModeTestSuite_test_parse_render_mode_good : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_parse_render_mode_good() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 8, "test_parse_render_mode_good" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_good(); }
+} testDescription_RenderModeTestSuite_test_parse_render_mode_good;
+
+static class TestDescription_RenderModeTestSuite_test_parse_render_mode_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_parse_render_mode_bad() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 28, "test_parse_render_mode_bad" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_bad(); }
+} testDescription_RenderModeTestSuite_test_parse_render_mode_bad;
+
+static class TestDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 46, "test_get_render_mode_code_back_and_forth" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_get_render_mode_code_back_and_forth(); }
+} testDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth;
+
+static class TestDescription_RenderModeTestSuite_test_render_2_guio : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_render_2_guio() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 64, "test_render_2_guio" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_render_2_guio(); }
+} testDescription_RenderModeTestSuite_test_render_2_guio;
+
+#include "test/common/rewindbuffer.h"
+
+static RewindBufferTestSuite suite_RewindBufferTestSuite;
+
+static CxxTest::List Tests_RewindBufferTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RewindBufferTestSuite( "test/common/rewindbuffer.h", 5, "RewindBufferTestSuite", suite_RewindBufferTestSuite, Tests_RewindBufferTestSuite );
+
+static class TestDescription_RewindBufferTestSuite_test_codec : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RewindBufferTestSuite_test_codec() : CxxTest::RealTestDescription( Tests_RewindBufferTestSuite, suiteDescription_RewindBufferTestSuite, 35, "test_codec" ) {}
+ void runTest() { suite_RewindBufferTestSuite.test_codec(); }
+} testDescription_RewindBufferTestSuite_test_codec;
+
+static class TestDescription_RewindBufferTestSuite_test_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RewindBufferTestSuite_test_push_pop() : CxxTest::RealTestDescription( Tests_RewindBufferTestSuite, suiteDescription_RewindBufferTestSuite, 62, "test_push_pop" ) {}
+ void runTest() { suite_RewindBufferTestSuite.test_push_pop(); }
+} testDescription_RewindBufferTestSuite_test_push_pop;
+
+static class TestDescription_RewindBufferTestSuite_test_budget : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RewindBufferTestSuite_test_budget() : CxxTest::RealTestDescription( Tests_RewindBufferTestSuite, suiteDescription_RewindBufferTestSuite, 96, "test_budget" ) {}
+ void runTest() { suite_RewindBufferTestSuite.test_budget(); }
+} testDescription_RewindBufferTestSuite_test_budget;
+
+#include "test/common/seekablesubreadstream.h"
+
+static SeekableSubReadStreamTestSuite suite_SeekableSubReadStreamTestSuite;
+
+static CxxTest::List Tests_SeekableSubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SeekableSubReadStreamTestSuite( "test/common/seekablesubreadstream.h", 6, "SeekableSubReadStreamTestSuite", suite_SeekableSubReadStreamTestSuite, Tests_SeekableSubReadStreamTestSuite );
+
+static class TestDescription_SeekableSubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekableSubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_traverse(); }
+} testDescription_SeekableSubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_SeekableSubReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekableSubReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 32, "test_seek" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_seek(); }
+} testDescription_SeekableSubReadStreamTestSuite_test_seek;
+
+#include "test/common/serializer.h"
+
+static SerializerTestSuite suite_SerializerTestSuite;
+
+static CxxTest::List Tests_SerializerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SerializerTestSuite( "test/common/serializer.h", 6, "SerializerTestSuite", suite_SerializerTestSuite, Tests_SerializerTestSuite );
+
+static class TestDescription_SerializerTestSuite_test_read_v1_as_v1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v1_as_v1() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 96, "test_read_v1_as_v1" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v1(); }
+} testDescription_SerializerTestSuite_test_read_v1_as_v1;
+
+static class TestDescription_SerializerTestSuite_test_read_v1_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v1_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 104, "test_read_v1_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v2(); }
+} testDescription_SerializerTestSuite_test_read_v1_as_v2;
+
+static class TestDescription_SerializerTestSuite_test_read_v2_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v2_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 108, "test_read_v2_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v2_as_v2(); }
+} testDescription_SerializerTestSuite_test_read_v2_as_v2;
+
+#include "test/common/span.h"
+
+static SpanTestSuite suite_SpanTestSuite;
+
+static CxxTest::List Tests_SpanTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SpanTestSuite( "test/common/span.h", 8, "SpanTestSuite", suite_SpanTestSuite, Tests_SpanTestSuite );
+
+static class TestDescription_SpanTestSuite_test_sibling_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_sibling_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 64, "test_sibling_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sibling_span(); }
+} testDescription_SpanTestSuite_test_sibling_span;
+
+static class TestDescription_SpanTestSuite_test_sub_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_sub_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 72, "test_sub_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sub_span(); }
+} testDescription_SpanTestSuite_test_sub_span;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_const : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_const() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 82, "test_span_iterator_const" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_const(); }
+} testDescription_SpanTestSuite_test_span_iterator_const;
+
+static class TestDescription_SpanTestSuite_test_span_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 134, "test_span_iterator" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator(); }
+} testDescription_SpanTestSuite_test_span_iterator;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 200, "test_span_iterator_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_integers(); }
+} testDescription_SpanTestSuite_test_span_iterator_integers;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_ptr() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 225, "test_span_iterator_ptr" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_ptr(); }
+} testDescription_SpanTestSuite_test_span_iterator_ptr;
+
+static class TestDescription_SpanTestSuite_test_span_owner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_owner() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 242, "test_span_owner" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner(); }
+} testDescription_SpanTestSuite_test_span_owner;
+
+static class TestDescription_SpanTestSuite_test_span_owner_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_owner_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 337, "test_span_owner_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner_named_span(); }
+} testDescription_SpanTestSuite_test_span_owner_named_span;
+
+static class TestDescription_SpanTestSuite_test_span_allocate_from_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_allocate_from_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 412, "test_span_allocate_from_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_allocate_from_stream(); }
+} testDescription_SpanTestSuite_test_span_allocate_from_stream;
+
+static class TestDescription_SpanTestSuite_test_span_byte : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_byte() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 447, "test_span_byte" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_byte(); }
+} testDescription_SpanTestSuite_test_span_byte;
+
+static class TestDescription_SpanTestSuite_test_span_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 485, "test_span_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_integers(); }
+} testDescription_SpanTestSuite_test_span_integers;
+
+static class TestDescription_SpanTestSuite_test_span_string : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_string() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 511, "test_span_string" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_string(); }
+} testDescription_SpanTestSuite_test_span_string;
+
+static class TestDescription_SpanTestSuite_test_span_unsafe_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_unsafe_data() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 524, "test_span_unsafe_data" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_unsafe_data(); }
+} testDescription_SpanTestSuite_test_span_unsafe_data;
+
+static class TestDescription_SpanTestSuite_test_span_subspan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_subspan() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 540, "test_span_subspan" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_subspan(); }
+} testDescription_SpanTestSuite_test_span_subspan;
+
+static class TestDescription_SpanTestSuite_test_span_to_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_to_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 601, "test_span_to_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_to_stream(); }
+} testDescription_SpanTestSuite_test_span_to_stream;
+
+static class TestDescription_SpanTestSuite_test_span_copying : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_copying() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 630, "test_span_copying" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_copying(); }
+} testDescription_SpanTestSuite_test_span_copying;
+
+static class TestDescription_SpanTestSuite_test_span_validation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_validation() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 648, "test_span_validation" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation(); }
+} testDescription_SpanTestSuite_test_span_validation;
+
+static class TestDescription_SpanTestSuite_test_span_validation_message : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_validation_message() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 668, "test_span_validation_message" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation_message(); }
+} testDescription_SpanTestSuite_test_span_validation_message;
+
+static class TestDescription_SpanTestSuite_test_span_comparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_comparators() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 689, "test_span_comparators" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_comparators(); }
+} testDescription_SpanTestSuite_test_span_comparators;
+
+static class TestDescription_SpanTestSuite_test_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 716, "test_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_named_span(); }
+} testDescription_SpanTestSuite_test_named_span;
+
+#include "test/common/stack.h"
+
+static StackTestSuite suite_StackTestSuite;
+
+static CxxTest::List Tests_StackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StackTestSuite( "test/common/stack.h", 5, "StackTestSuite", suite_StackTestSuite, Tests_StackTestSuite );
+
+static class TestDescription_StackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_StackTestSuite.test_empty_clear(); }
+} testDescription_StackTestSuite_test_empty_clear;
+
+static class TestDescription_StackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_StackTestSuite.test_size(); }
+} testDescription_StackTestSuite_test_size;
+
+static class TestDescription_StackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_StackTestSuite.test_top_pop(); }
+} testDescription_StackTestSuite_test_top_pop;
+
+static class TestDescription_StackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_StackTestSuite.test_assign(); }
+} testDescription_StackTestSuite_test_assign;
+
+#include "test/common/str.h"
+
+static StringTestSuite suite_StringTestSuite;
+
+static CxxTest::List Tests_StringTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StringTestSuite( "test/common/str.h", 8, "StringTestSuite", suite_StringTestSuite, Tests_StringTestSuite );
+
+static class TestDescription_StringTestSuite_test_constructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_constructors() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 11, "test_constructors" ) {}
+ void runTest() { suite_StringTestSuite.test_constructors(); }
+} testDescription_StringTestSuite_test_constructors;
+
+static class TestDescription_StringTestSuite_test_trim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_trim() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 24, "test_trim" ) {}
+ void runTest() { suite_StringTestSuite.test_trim(); }
+} testDescription_StringTestSuite_test_trim;
+
+static class TestDescription_StringTestSuite_test_chop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_chop() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 32, "test_chop" ) {}
+ void runTest() { suite_StringTestSuite.test_chop(); }
+} testDescription_StringTestSuite_test_chop;
+
+static class TestDescription_StringTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 56, "test_empty_clear" ) {}
+ void runTest() { suite_StringTestSuite.test_empty_clear(); }
+} testDescription_StringTestSuite_test_empty_clear;
+
+static class TestDescription_StringTestSuite_test_lastChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_lastChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 63, "test_lastChar" ) {}
+ void runTest() { suite_StringTestSuite.test_lastChar(); }
+} testDescription_StringTestSuite_test_lastChar;
+
+static class TestDescription_StringTestSuite_test_firstChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_firstChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 72, "test_firstChar" ) {}
+ void runTest() { suite_StringTestSuite.test_firstChar(); }
+} testDescription_StringTestSuite_test_firstChar;
+
+static class TestDescription_StringTestSuite_test_assign1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_assign1() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 81, "test_assign1" ) {}
+ void runTest() { suite_StringTestSuite.test_assign1(); }
+} testDescription_StringTestSuite_test_assign1;
+
+static class TestDescription_StringTestSuite_test_assign2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_assign2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 87, "test_assign2" ) {}
+ void runTest() { suite_StringTestSuite.test_assign2(); }
+} testDescription_StringTestSuite_test_assign2;
+
+static class TestDescription_StringTestSuite_test_assign3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_assign3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 93, "test_assign3" ) {}
+ void runTest() { suite_StringTestSuite.test_assign3(); }
+} testDescription_StringTestSuite_test_assign3;
+
+static class TestDescription_StringTestSuite_test_concat1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat1() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 99, "test_concat1" ) {}
+ void runTest() { suite_StringTestSuite.test_concat1(); }
+} testDescription_StringTestSuite_test_concat1;
+
+static class TestDescription_StringTestSuite_test_concat2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 107, "test_concat2" ) {}
+ void runTest() { suite_StringTestSuite.test_concat2(); }
+} testDescription_StringTestSuite_test_concat2;
+
+static class TestDescription_StringTestSuite_test_concat3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 113, "test_concat3" ) {}
+ void runTest() { suite_StringTestSuite.test_concat3(); }
+} testDescription_StringTestSuite_test_concat3;
+
+static class TestDescription_StringTestSuite_test_concat4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat4() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 119, "test_concat4" ) {}
+ void runTest() { suite_StringTestSuite.test_concat4(); }
+} testDescription_StringTestSuite_test_concat4;
+
+static class TestDescription_StringTestSuite_test_refCount : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 125, "test_refCount" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount(); }
+} testDescription_StringTestSuite_test_refCount;
+
+static class TestDescription_StringTestSuite_test_refCount2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 140, "test_refCount2" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount2(); }
+} testDescription_StringTestSuite_test_refCount2;
+
+static class TestDescription_StringTestSuite_test_refCount3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 155, "test_refCount3" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount3(); }
+} testDescription_StringTestSuite_test_refCount3;
+
+static class TestDescription_StringTestSuite_test_refCount4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount4() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 169, "test_refCount4" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount4(); }
+} testDescription_StringTestSuite_test_refCount4;
+
+static class TestDescription_StringTestSuite_test_refCount5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount5() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 183, "test_refCount5" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount5(); }
+} testDescription_StringTestSuite_test_refCount5;
+
+static class TestDescription_StringTestSuite_test_refCount6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount6() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 195, "test_refCount6" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount6(); }
+} testDescription_StringTestSuite_test_refCount6;
+
+static class TestDescription_StringTestSuite_test_self_asignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_self_asignment() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 207, "test_self_asignment" ) {}
+ void runTest() { suite_StringTestSuite.test_self_asignment(); }
+} testDescription_StringTestSuite_test_self_asignment;
+
+static class TestDescription_StringTestSuite_test_hasPrefix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_hasPrefix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 257, "test_hasPrefix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasPrefix(); }
+} testDescription_StringTestSuite_test_hasPrefix;
+
+static class TestDescription_StringTestSuite_test_hasSuffix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_hasSuffix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 265, "test_hasSuffix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasSuffix(); }
+} testDescription_StringTestSuite_test_hasSuffix;
+
+static class TestDescription_StringTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 273, "test_contains" ) {}
+ void runTest() { suite_StringTestSuite.test_contains(); }
+} testDescription_StringTestSuite_test_contains;
+
+static class TestDescription_StringTestSuite_test_toLowercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_toLowercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 284, "test_toLowercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toLowercase(); }
+} testDescription_StringTestSuite_test_toLowercase;
+
+static class TestDescription_StringTestSuite_test_toUppercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_toUppercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 292, "test_toUppercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toUppercase(); }
+} testDescription_StringTestSuite_test_toUppercase;
+
+static class TestDescription_StringTestSuite_test_deleteChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_deleteChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 300, "test_deleteChar" ) {}
+ void runTest() { suite_StringTestSuite.test_deleteChar(); }
+} testDescription_StringTestSuite_test_deleteChar;
+
+static class TestDescription_StringTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 308, "test_erase" ) {}
+ void runTest() { suite_StringTestSuite.test_erase(); }
+} testDescription_StringTestSuite_test_erase;
+
+static class TestDescription_StringTestSuite_test_sharing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_sharing() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 316, "test_sharing" ) {}
+ void runTest() { suite_StringTestSuite.test_sharing(); }
+} testDescription_StringTestSuite_test_sharing;
+
+static class TestDescription_StringTestSuite_test_lastPathComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_lastPathComponent() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 325, "test_lastPathComponent" ) {}
+ void runTest() { suite_StringTestSuite.test_lastPathComponent(); }
+} testDescription_StringTestSuite_test_lastPathComponent;
+
+static class TestDescription_StringTestSuite_test_normalizePath : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_normalizePath() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 343, "test_normalizePath" ) {}
+ void runTest() { suite_StringTestSuite.test_normalizePath(); }
+} testDescription_StringTestSuite_test_normalizePath;
+
+static class TestDescription_StringTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 372, "test_matchString" ) {}
+ void runTest() { suite_StringTestSuite.test_matchString(); }
+} testDescription_StringTestSuite_test_matchString;
+
+static class TestDescription_StringTestSuite_test_string_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_string_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 408, "test_string_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_string_printf(); }
+} testDescription_StringTestSuite_test_string_printf;
+
+static class TestDescription_StringTestSuite_test_ustring_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustring_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 419, "test_ustring_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_printf(); }
+} testDescription_StringTestSuite_test_ustring_printf;
+
+static class TestDescription_StringTestSuite_test_strlcpy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strlcpy() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 436, "test_strlcpy" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcpy(); }
+} testDescription_StringTestSuite_test_strlcpy;
+
+static class TestDescription_StringTestSuite_test_strlcat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strlcat() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 458, "test_strlcat" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcat(); }
+} testDescription_StringTestSuite_test_strlcat;
+
+static class TestDescription_StringTestSuite_test_strnlen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strnlen() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 489, "test_strnlen" ) {}
+ void runTest() { suite_StringTestSuite.test_strnlen(); }
+} testDescription_StringTestSuite_test_strnlen;
+
+static class TestDescription_StringTestSuite_test_scumm_stricmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_scumm_stricmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 512, "test_scumm_stricmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_stricmp(); }
+} testDescription_StringTestSuite_test_scumm_stricmp;
+
+static class TestDescription_StringTestSuite_test_scumm_strnicmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_scumm_strnicmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 519, "test_scumm_strnicmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_strnicmp(); }
+} testDescription_StringTestSuite_test_scumm_strnicmp;
+
+static class TestDescription_StringTestSuite_test_wordWrap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_wordWrap() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 529, "test_wordWrap" ) {}
+ void runTest() { suite_StringTestSuite.test_wordWrap(); }
+} testDescription_StringTestSuite_test_wordWrap;
+
+static class TestDescription_StringTestSuite_test_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 551, "test_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_replace(); }
+} testDescription_StringTestSuite_test_replace;
+
+static class TestDescription_StringTestSuite_test_ustring_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustring_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 625, "test_ustring_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_replace(); }
+} testDescription_StringTestSuite_test_ustring_replace;
+
+static class TestDescription_StringTestSuite_test_find : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_find() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 683, "test_find" ) {}
+ void runTest() { suite_StringTestSuite.test_find(); }
+} testDescription_StringTestSuite_test_find;
+
+static class TestDescription_StringTestSuite_test_setChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_setChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 699, "test_setChar" ) {}
+ void runTest() { suite_StringTestSuite.test_setChar(); }
+} testDescription_StringTestSuite_test_setChar;
+
+static class TestDescription_StringTestSuite_test_insertChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_insertChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 707, "test_insertChar" ) {}
+ void runTest() { suite_StringTestSuite.test_insertChar(); }
+} testDescription_StringTestSuite_test_insertChar;
+
+static class TestDescription_StringTestSuite_test_insertString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_insertString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 717, "test_insertString" ) {}
+ void runTest() { suite_StringTestSuite.test_insertString(); }
+} testDescription_StringTestSuite_test_insertString;
+
+static class TestDescription_StringTestSuite_test_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 727, "test_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_comparison(); }
+} testDescription_StringTestSuite_test_comparison;
+
+static class TestDescription_StringTestSuite_test_ustr_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustr_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 750, "test_ustr_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_ustr_comparison(); }
+} testDescription_StringTestSuite_test_ustr_comparison;
+
+#include "test/common/stream.h"
+
+static ReadLineStreamTestSuite suite_ReadLineStreamTestSuite;
+
+static CxxTest::List Tests_ReadLineStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ReadLineStreamTestSuite( "test/common/stream.h", 5, "ReadLineStreamTestSuite", suite_ReadLineStreamTestSuite, Tests_ReadLineStreamTestSuite );
+
+static class TestDescription_ReadLineStreamTestSuite_test_readline : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ReadLineStreamTestSuite_test_readline() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 7, "test_readline" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline(); }
+} testDescription_ReadLineStreamTestSuite_test_readline;
+
+static class TestDescription_ReadLineStreamTestSuite_test_readline2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ReadLineStreamTestSuite_test_readline2() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 29, "test_readline2" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline2(); }
+} testDescription_ReadLineStreamTestSuite_test_readline2;
+
+#include "test/common/subreadstream.h"
+
+static SubReadStreamTestSuite suite_SubReadStreamTestSuite;
+
+static CxxTest::List Tests_SubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SubReadStreamTestSuite( "test/common/subreadstream.h", 6, "SubReadStreamTestSuite", suite_SubReadStreamTestSuite, Tests_SubReadStreamTestSuite );
+
+static class TestDescription_SubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_traverse(); }
+} testDescription_SubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_SubReadStreamTestSuite_test_safe_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SubReadStreamTestSuite_test_safe_eos() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 30, "test_safe_eos" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_safe_eos(); }
+} testDescription_SubReadStreamTestSuite_test_safe_eos;
+
+#include "test/common/tokenizer.h"
+
+static TokenizerTestSuite suite_TokenizerTestSuite;
+
+static CxxTest::List Tests_TokenizerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TokenizerTestSuite( "test/common/tokenizer.h", 5, "TokenizerTestSuite", suite_TokenizerTestSuite, Tests_TokenizerTestSuite );
+
+static class TestDescription_TokenizerTestSuite_test_nextToken : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TokenizerTestSuite_test_nextToken() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 7, "test_nextToken" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_nextToken(); }
+} testDescription_TokenizerTestSuite_test_nextToken;
+
+static class TestDescription_TokenizerTestSuite_test_resetAndEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TokenizerTestSuite_test_resetAndEmpty() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 40, "test_resetAndEmpty" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_resetAndEmpty(); }
+} testDescription_TokenizerTestSuite_test_resetAndEmpty;
+
+#include "test/common/util.h"
+
+static UtilTestSuite suite_UtilTestSuite;
+
+static CxxTest::List Tests_UtilTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UtilTestSuite( "test/common/util.h", 7, "UtilTestSuite", suite_UtilTestSuite, Tests_UtilTestSuite );
+
+static class TestDescription_UtilTestSuite_test_parsebool_yesno : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_yesno() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 9, "test_parsebool_yesno" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_yesno(); }
+} testDescription_UtilTestSuite_test_parsebool_yesno;
+
+static class TestDescription_UtilTestSuite_test_parsebool_truefalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_truefalse() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 28, "test_parsebool_truefalse" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_truefalse(); }
+} testDescription_UtilTestSuite_test_parsebool_truefalse;
+
+static class TestDescription_UtilTestSuite_test_parsebool_onezero : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_onezero() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 47, "test_parsebool_onezero" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_onezero(); }
+} testDescription_UtilTestSuite_test_parsebool_onezero;
+
+static class TestDescription_UtilTestSuite_test_parsebool_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_bad() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 70, "test_parsebool_bad" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_bad(); }
+} testDescription_UtilTestSuite_test_parsebool_bad;
+
+static class TestDescription_UtilTestSuite_test_is_al_num : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_al_num() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 107, "test_is_al_num" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_al_num(); }
+} testDescription_UtilTestSuite_test_is_al_num;
+
+static class TestDescription_UtilTestSuite_test_is_alpha : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_alpha() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 128, "test_is_alpha" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_alpha(); }
+} testDescription_UtilTestSuite_test_is_alpha;
+
+static class TestDescription_UtilTestSuite_test_is_digit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_digit() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 149, "test_is_digit" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_digit(); }
+} testDescription_UtilTestSuite_test_is_digit;
+
+static class TestDescription_UtilTestSuite_test_is_lower : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_lower() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 170, "test_is_lower" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_lower(); }
+} testDescription_UtilTestSuite_test_is_lower;
+
+static class TestDescription_UtilTestSuite_test_is_upper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_upper() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 192, "test_is_upper" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_upper(); }
+} testDescription_UtilTestSuite_test_is_upper;
+
+static class TestDescription_UtilTestSuite_test_is_space : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_space() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 212, "test_is_space" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_space(); }
+} testDescription_UtilTestSuite_test_is_space;
+
+static class TestDescription_UtilTestSuite_test_is_print : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_print() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 226, "test_is_print" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_print(); }
+} testDescription_UtilTestSuite_test_is_print;
+
+static class TestDescription_UtilTestSuite_test_is_punct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_punct() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 237, "test_is_punct" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_punct(); }
+} testDescription_UtilTestSuite_test_is_punct;
+
+#include "test/common/formats/quicktime.h"
+
+static QuicktimeParserTestSuite suite_QuicktimeParserTestSuite;
+
+static CxxTest::List Tests_QuicktimeParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuicktimeParserTestSuite( "test/common/formats/quicktime.h", 40, "QuicktimeParserTestSuite", suite_QuicktimeParserTestSuite, Tests_QuicktimeParserTestSuite );
+
+static class TestDescription_QuicktimeParserTestSuite_test_streamAtEOS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_streamAtEOS() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 42, "test_streamAtEOS" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamAtEOS(); }
+} testDescription_QuicktimeParserTestSuite_test_streamAtEOS;
+
+static class TestDescription_QuicktimeParserTestSuite_test_streamInvalid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_streamInvalid() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 51, "test_streamInvalid" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamInvalid(); }
+} testDescription_QuicktimeParserTestSuite_test_streamInvalid;
+
+static class TestDescription_QuicktimeParserTestSuite_test_moov : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_moov() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 59, "test_moov" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_moov(); }
+} testDescription_QuicktimeParserTestSuite_test_moov;
+
+static class TestDescription_QuicktimeParserTestSuite_test_mhdr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_mhdr() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 66, "test_mhdr" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdr(); }
+} testDescription_QuicktimeParserTestSuite_test_mhdr;
+
+static class TestDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 76, "test_mhdrEarlyEOF" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdrEarlyEOF(); }
+} testDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF;
+
+#include "test/common/formats/xmlparser.h"
+
+static XMLParserTestSuite suite_XMLParserTestSuite;
+
+static CxxTest::List Tests_XMLParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_XMLParserTestSuite( "test/common/formats/xmlparser.h", 49, "XMLParserTestSuite", suite_XMLParserTestSuite, Tests_XMLParserTestSuite );
+
+static class TestDescription_XMLParserTestSuite_test_compiled : public CxxTest::RealTestDescription {
+public:
+ TestDescription_XMLParserTestSuite_test_compiled() : CxxTest::RealTestDescription( Tests_XMLParserTestSuite, suiteDescription_XMLParserTestSuite, 51, "test_compiled" ) {}
+ void runTest() { suite_XMLParserTestSuite.test_compiled(); }
+} testDescription_XMLParserTestSuite_test_compiled;
+
+#include "test/audio/audiostream.h"
+
+static AudioStreamTestSuite suite_AudioStreamTestSuite;
+
+static CxxTest::List Tests_AudioStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AudioStreamTestSuite( "test/audio/audiostream.h", 7, "AudioStreamTestSuite", suite_AudioStreamTestSuite, Tests_AudioStreamTestSuite );
+
+static class TestDescription_AudioStreamTestSuite_test_convertTimeToStreamPos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_convertTimeToStreamPos() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 10, "test_convertTimeToStreamPos" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_convertTimeToStreamPos(); }
+} testDescription_AudioStreamTestSuite_test_convertTimeToStreamPos;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 104, "test_looping_audio_stream_mono_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_11025_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 108, "test_looping_audio_stream_mono_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_22050_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 112, "test_looping_audio_stream_stereo_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_11025_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 116, "test_looping_audio_stream_stereo_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_22050_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 177, "test_sub_looping_audio_stream_mono_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 181, "test_sub_looping_audio_stream_mono_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 185, "test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 189, "test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 193, "test_sub_looping_audio_stream_mono_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 197, "test_sub_looping_audio_stream_mono_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 201, "test_sub_looping_audio_stream_stereo_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 205, "test_sub_looping_audio_stream_stereo_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter;
+
+#include "test/audio/raw.h"
+
+static RawStreamTestSuite suite_RawStreamTestSuite;
+
+static CxxTest::List Tests_RawStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RawStreamTestSuite( "test/audio/raw.h", 8, "RawStreamTestSuite", suite_RawStreamTestSuite, Tests_RawStreamTestSuite );
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 28, "test_read_buffer_8_bit_signed_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 32, "test_read_buffer_8_bit_signed_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 36, "test_read_buffer_8_bit_unsigned_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_unsigned_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 40, "test_read_buffer_16_bit_signed_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 44, "test_read_buffer_16_bit_signed_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 48, "test_read_buffer_16_bit_unsigned_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 52, "test_read_buffer_16_bit_unsigned_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 56, "test_read_buffer_16_bit_signed_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 60, "test_read_buffer_16_bit_signed_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 64, "test_read_buffer_16_bit_unsigned_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 68, "test_read_buffer_16_bit_unsigned_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_partial_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_partial_read() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 98, "test_partial_read" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_partial_read(); }
+} testDescription_RawStreamTestSuite_test_partial_read;
+
+static class TestDescription_RawStreamTestSuite_test_read_after_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_after_end() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 120, "test_read_after_end" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_after_end(); }
+} testDescription_RawStreamTestSuite_test_read_after_end;
+
+static class TestDescription_RawStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 144, "test_rewind" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_rewind(); }
+} testDescription_RawStreamTestSuite_test_rewind;
+
+static class TestDescription_RawStreamTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_length() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 207, "test_length" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_length(); }
+} testDescription_RawStreamTestSuite_test_length;
+
+static class TestDescription_RawStreamTestSuite_test_seek_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_seek_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 284, "test_seek_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_mono(); }
+} testDescription_RawStreamTestSuite_test_seek_mono;
+
+static class TestDescription_RawStreamTestSuite_test_seek_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_seek_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 288, "test_seek_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_stereo(); }
+} testDescription_RawStreamTestSuite_test_seek_stereo;
+
+#include "test/audio/timestamp.h"
+
+static TimestampTestSuite suite_TimestampTestSuite;
+
+static CxxTest::List Tests_TimestampTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimestampTestSuite( "test/audio/timestamp.h", 5, "TimestampTestSuite", suite_TimestampTestSuite, Tests_TimestampTestSuite );
+
+static class TestDescription_TimestampTestSuite_test_diff_add_frames : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_add_frames() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 8, "test_diff_add_frames" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_frames(); }
+} testDescription_TimestampTestSuite_test_diff_add_frames;
+
+static class TestDescription_TimestampTestSuite_test_diff_add_msecs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_add_msecs() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 26, "test_diff_add_msecs" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_msecs(); }
+} testDescription_TimestampTestSuite_test_diff_add_msecs;
+
+static class TestDescription_TimestampTestSuite_test_ticks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_ticks() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 58, "test_ticks" ) {}
+ void runTest() { suite_TimestampTestSuite.test_ticks(); }
+} testDescription_TimestampTestSuite_test_ticks;
+
+static class TestDescription_TimestampTestSuite_test_more_add_diff : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_more_add_diff() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 85, "test_more_add_diff" ) {}
+ void runTest() { suite_TimestampTestSuite.test_more_add_diff(); }
+} testDescription_TimestampTestSuite_test_more_add_diff;
+
+static class TestDescription_TimestampTestSuite_test_negate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_negate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 94, "test_negate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_negate(); }
+} testDescription_TimestampTestSuite_test_negate;
+
+static class TestDescription_TimestampTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 103, "test_add_sub" ) {}
+ void runTest() { suite_TimestampTestSuite.test_add_sub(); }
+} testDescription_TimestampTestSuite_test_add_sub;
+
+static class TestDescription_TimestampTestSuite_test_diff_with_conversion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_with_conversion() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 127, "test_diff_with_conversion" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_with_conversion(); }
+} testDescription_TimestampTestSuite_test_diff_with_conversion;
+
+static class TestDescription_TimestampTestSuite_test_convert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_convert() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 146, "test_convert" ) {}
+ void runTest() { suite_TimestampTestSuite.test_convert(); }
+} testDescription_TimestampTestSuite_test_convert;
+
+static class TestDescription_TimestampTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 155, "test_equals" ) {}
+ void runTest() { suite_TimestampTestSuite.test_equals(); }
+} testDescription_TimestampTestSuite_test_equals;
+
+static class TestDescription_TimestampTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 175, "test_compare" ) {}
+ void runTest() { suite_TimestampTestSuite.test_compare(); }
+} testDescription_TimestampTestSuite_test_compare;
+
+static class TestDescription_TimestampTestSuite_test_framerate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_framerate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 209, "test_framerate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_framerate(); }
+} testDescription_TimestampTestSuite_test_framerate;
+
+static class TestDescription_TimestampTestSuite_test_direct_query : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_direct_query() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 221, "test_direct_query" ) {}
+ void runTest() { suite_TimestampTestSuite.test_direct_query(); }
+} testDescription_TimestampTestSuite_test_direct_query;
+
+static class TestDescription_TimestampTestSuite_test_no_overflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_no_overflow() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 242, "test_no_overflow" ) {}
+ void runTest() { suite_TimestampTestSuite.test_no_overflow(); }
+} testDescription_TimestampTestSuite_test_no_overflow;
+
+#include "test/math/quat.h"
+
+static QuatTestSuite suite_QuatTestSuite;
+
+static CxxTest::List Tests_QuatTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuatTestSuite( "test/math/quat.h", 5, "QuatTestSuite", suite_QuatTestSuite, Tests_QuatTestSuite );
+
+static class TestDescription_QuatTestSuite_test_Quaternion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_Quaternion() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 8, "test_Quaternion" ) {}
+ void runTest() { suite_QuatTestSuite.test_Quaternion(); }
+} testDescription_QuatTestSuite_test_Quaternion;
+
+static class TestDescription_QuatTestSuite_test_Normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_Normalize() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 19, "test_Normalize" ) {}
+ void runTest() { suite_QuatTestSuite.test_Normalize(); }
+} testDescription_QuatTestSuite_test_Normalize;
+
+static class TestDescription_QuatTestSuite_test_quatMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatMatrix() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 35, "test_quatMatrix" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatMatrix(); }
+} testDescription_QuatTestSuite_test_quatMatrix;
+
+static class TestDescription_QuatTestSuite_test_quatRotationXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatRotationXYZ() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 53, "test_quatRotationXYZ" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatRotationXYZ(); }
+} testDescription_QuatTestSuite_test_quatRotationXYZ;
+
+static class TestDescription_QuatTestSuite_test_quatAngleBetween : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatAngleBetween() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 80, "test_quatAngleBetween" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatAngleBetween(); }
+} testDescription_QuatTestSuite_test_quatAngleBetween;
+
+static class TestDescription_QuatTestSuite_test_invert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_invert() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 91, "test_invert" ) {}
+ void runTest() { suite_QuatTestSuite.test_invert(); }
+} testDescription_QuatTestSuite_test_invert;
+
+#include "test/math/ray.h"
+
+static RayTestSuite suite_RayTestSuite;
+
+static CxxTest::List Tests_RayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RayTestSuite( "test/math/ray.h", 5, "RayTestSuite", suite_RayTestSuite, Tests_RayTestSuite );
+
+static class TestDescription_RayTestSuite_test_Ray : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_Ray() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 8, "test_Ray" ) {}
+ void runTest() { suite_RayTestSuite.test_Ray(); }
+} testDescription_RayTestSuite_test_Ray;
+
+static class TestDescription_RayTestSuite_test_translate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_translate() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 23, "test_translate" ) {}
+ void runTest() { suite_RayTestSuite.test_translate(); }
+} testDescription_RayTestSuite_test_translate;
+
+static class TestDescription_RayTestSuite_test_intersectTriangle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_intersectTriangle() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 38, "test_intersectTriangle" ) {}
+ void runTest() { suite_RayTestSuite.test_intersectTriangle(); }
+} testDescription_RayTestSuite_test_intersectTriangle;
+
+#include "test/math/rotation3d.h"
+
+static Rotation3DTestSuite suite_Rotation3DTestSuite;
+
+static CxxTest::List Tests_Rotation3DTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rotation3DTestSuite( "test/math/rotation3d.h", 5, "Rotation3DTestSuite", suite_Rotation3DTestSuite, Tests_Rotation3DTestSuite );
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 7, "test_eulerXYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYX(); }
+} testDescription_Rotation3DTestSuite_test_eulerXYX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 23, "test_eulerXYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerXYZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 39, "test_eulerXZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZX(); }
+} testDescription_Rotation3DTestSuite_test_eulerXZX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 55, "test_eulerXZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZY(); }
+} testDescription_Rotation3DTestSuite_test_eulerXZY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 71, "test_eulerYXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXY(); }
+} testDescription_Rotation3DTestSuite_test_eulerYXY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 87, "test_eulerYXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerYXZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 103, "test_eulerYZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZX(); }
+} testDescription_Rotation3DTestSuite_test_eulerYZX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 119, "test_eulerYZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZY(); }
+} testDescription_Rotation3DTestSuite_test_eulerYZY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 135, "test_eulerZXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXY(); }
+} testDescription_Rotation3DTestSuite_test_eulerZXY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 151, "test_eulerZXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerZXZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 167, "test_eulerZYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYX(); }
+} testDescription_Rotation3DTestSuite_test_eulerZYX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 183, "test_eulerZYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerZYZ;
+
+#include "test/math/utils.h"
+
+static MathUtilsTestSuite suite_MathUtilsTestSuite;
+
+static CxxTest::List Tests_MathUtilsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MathUtilsTestSuite( "test/math/utils.h", 7, "MathUtilsTestSuite", suite_MathUtilsTestSuite, Tests_MathUtilsTestSuite );
+
+static class TestDescription_MathUtilsTestSuite_test_rad2deg : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MathUtilsTestSuite_test_rad2deg() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 10, "test_rad2deg" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_rad2deg(); }
+} testDescription_MathUtilsTestSuite_test_rad2deg;
+
+static class TestDescription_MathUtilsTestSuite_test_deg2rad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MathUtilsTestSuite_test_deg2rad() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 23, "test_deg2rad" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_deg2rad(); }
+} testDescription_MathUtilsTestSuite_test_deg2rad;
+
+#include "test/math/vector3d.h"
+
+static Vector3dTestSuite suite_Vector3dTestSuite;
+
+static CxxTest::List Tests_Vector3dTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Vector3dTestSuite( "test/math/vector3d.h", 5, "Vector3dTestSuite", suite_Vector3dTestSuite, Tests_Vector3dTestSuite );
+
+static class TestDescription_Vector3dTestSuite_test_Vector3d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_Vector3d() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 8, "test_Vector3d" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_Vector3d(); }
+} testDescription_Vector3dTestSuite_test_Vector3d;
+
+static class TestDescription_Vector3dTestSuite_test_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_set() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 28, "test_set" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_set(); }
+} testDescription_Vector3dTestSuite_test_set;
+
+static class TestDescription_Vector3dTestSuite_test_crossProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_crossProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 37, "test_crossProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_crossProduct(); }
+} testDescription_Vector3dTestSuite_test_crossProduct;
+
+static class TestDescription_Vector3dTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_length() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 48, "test_length" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_length(); }
+} testDescription_Vector3dTestSuite_test_length;
+
+static class TestDescription_Vector3dTestSuite_test_interpolate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_interpolate() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 59, "test_interpolate" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_interpolate(); }
+} testDescription_Vector3dTestSuite_test_interpolate;
+
+static class TestDescription_Vector3dTestSuite_test_setValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_setValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 72, "test_setValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_setValue(); }
+} testDescription_Vector3dTestSuite_test_setValue;
+
+static class TestDescription_Vector3dTestSuite_test_getValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_getValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 87, "test_getValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_getValue(); }
+} testDescription_Vector3dTestSuite_test_getValue;
+
+static class TestDescription_Vector3dTestSuite_test_dotProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_dotProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 95, "test_dotProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProduct(); }
+} testDescription_Vector3dTestSuite_test_dotProduct;
+
+static class TestDescription_Vector3dTestSuite_test_dotProductOrthogonal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_dotProductOrthogonal() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 104, "test_dotProductOrthogonal" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProductOrthogonal(); }
+} testDescription_Vector3dTestSuite_test_dotProductOrthogonal;
+
+static class TestDescription_Vector3dTestSuite_test_normalizeTrivial : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_normalizeTrivial() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 113, "test_normalizeTrivial" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalizeTrivial(); }
+} testDescription_Vector3dTestSuite_test_normalizeTrivial;
+
+static class TestDescription_Vector3dTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 126, "test_normalize" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalize(); }
+} testDescription_Vector3dTestSuite_test_normalize;
+
+static class TestDescription_Vector3dTestSuite_test_magnitude : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_magnitude() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 138, "test_magnitude" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_magnitude(); }
+} testDescription_Vector3dTestSuite_test_magnitude;
+
+#include "test/image/blending.h"
+
+static BlendBlitUnfilteredTestSuite suite_BlendBlitUnfilteredTestSuite;
+
+static CxxTest::List Tests_BlendBlitUnfilteredTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BlendBlitUnfilteredTestSuite( "test/image/blending.h", 797, "BlendBlitUnfilteredTestSuite", suite_BlendBlitUnfilteredTestSuite, Tests_BlendBlitUnfilteredTestSuite );
+
+static class TestDescription_BlendBlitUnfilteredTestSuite_test_blend_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BlendBlitUnfilteredTestSuite_test_blend_speed() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 799, "test_blend_speed" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_speed(); }
+} testDescription_BlendBlitUnfilteredTestSuite_test_blend_speed;
+
+static class TestDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 908, "test_blend_blit_unfiltered" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_blit_unfiltered(); }
+} testDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered;
+
+#include "test/image/gif.h"
+
+static GIFDecoderTestSuite suite_GIFDecoderTestSuite;
+
+static CxxTest::List Tests_GIFDecoderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GIFDecoderTestSuite( "test/image/gif.h", 11, "GIFDecoderTestSuite", suite_GIFDecoderTestSuite, Tests_GIFDecoderTestSuite );
+
+static class TestDescription_GIFDecoderTestSuite_test_load_gif_2x2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_GIFDecoderTestSuite_test_load_gif_2x2() : CxxTest::RealTestDescription( Tests_GIFDecoderTestSuite, suiteDescription_GIFDecoderTestSuite, 13, "test_load_gif_2x2" ) {}
+ void runTest() { suite_GIFDecoderTestSuite.test_load_gif_2x2(); }
+} testDescription_GIFDecoderTestSuite_test_load_gif_2x2;
+
+#include "test/engines/wintermute/path_utils.h"
+
+static PathUtilTestSuite suite_PathUtilTestSuite;
+
+static CxxTest::List Tests_PathUtilTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PathUtilTestSuite( "test/engines/wintermute/path_utils.h", 13, "PathUtilTestSuite", suite_PathUtilTestSuite, Tests_PathUtilTestSuite );
+
+static class TestDescription_PathUtilTestSuite_test_getdirectoryname : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_getdirectoryname() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 43, "test_getdirectoryname" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_getdirectoryname(); }
+} testDescription_PathUtilTestSuite_test_getdirectoryname;
+
+static class TestDescription_PathUtilTestSuite_test_getfilename : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_getfilename() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 74, "test_getfilename" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_getfilename(); }
+} testDescription_PathUtilTestSuite_test_getfilename;
+
+static class TestDescription_PathUtilTestSuite_test_getextension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_getextension() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 113, "test_getextension" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_getextension(); }
+} testDescription_PathUtilTestSuite_test_getextension;
+
+static class TestDescription_PathUtilTestSuite_test_getfilenamewithoutextension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_getfilenamewithoutextension() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 144, "test_getfilenamewithoutextension" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_getfilenamewithoutextension(); }
+} testDescription_PathUtilTestSuite_test_getfilenamewithoutextension;
+
+static class TestDescription_PathUtilTestSuite_test_combine_identity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_combine_identity() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 175, "test_combine_identity" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_combine_identity(); }
+} testDescription_PathUtilTestSuite_test_combine_identity;
+
+static class TestDescription_PathUtilTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathUtilTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_PathUtilTestSuite, suiteDescription_PathUtilTestSuite, 206, "test_normalize" ) {}
+ void runTest() { suite_PathUtilTestSuite.test_normalize(); }
+} testDescription_PathUtilTestSuite_test_normalize;
+
+#include "test/engines/ultima/ultima8/games/treasure_loader.h"
+
+static U8TreasureLoaderTestSuite suite_U8TreasureLoaderTestSuite;
+
+static CxxTest::List Tests_U8TreasureLoaderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8TreasureLoaderTestSuite( "test/engines/ultima/ultima8/games/treasure_loader.h", 13, "U8TreasureLoaderTestSuite", suite_U8TreasureLoaderTestSuite, Tests_U8TreasureLoaderTestSuite );
+
+static class TestDescription_U8TreasureLoaderTestSuite_test_parse_empty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8TreasureLoaderTestSuite_test_parse_empty() : CxxTest::RealTestDescription( Tests_U8TreasureLoaderTestSuite, suiteDescription_U8TreasureLoaderTestSuite, 20, "test_parse_empty" ) {}
+ void runTest() { suite_U8TreasureLoaderTestSuite.test_parse_empty(); }
+} testDescription_U8TreasureLoaderTestSuite_test_parse_empty;
+
+static class TestDescription_U8TreasureLoaderTestSuite_test_parse_basic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8TreasureLoaderTestSuite_test_parse_basic() : CxxTest::RealTestDescription( Tests_U8TreasureLoaderTestSuite, suiteDescription_U8TreasureLoaderTestSuite, 28, "test_parse_basic" ) {}
+ void runTest() { suite_U8TreasureLoaderTestSuite.test_parse_basic(); }
+} testDescription_U8TreasureLoaderTestSuite_test_parse_basic;
+
+static class TestDescription_U8TreasureLoaderTestSuite_test_parse_multi : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8TreasureLoaderTestSuite_test_parse_multi() : CxxTest::RealTestDescription( Tests_U8TreasureLoaderTestSuite, suiteDescription_U8TreasureLoaderTestSuite, 50, "test_parse_multi" ) {}
+ void runTest() { suite_U8TreasureLoaderTestSuite.test_parse_multi(); }
+} testDescription_U8TreasureLoaderTestSuite_test_parse_multi;
+
+static class TestDescription_U8TreasureLoaderTestSuite_test_parse_invalid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8TreasureLoaderTestSuite_test_parse_invalid() : CxxTest::RealTestDescription( Tests_U8TreasureLoaderTestSuite, suiteDescription_U8TreasureLoaderTestSuite, 81, "test_parse_invalid" ) {}
+ void runTest() { suite_U8TreasureLoaderTestSuite.test_parse_invalid(); }
+} testDescription_U8TreasureLoaderTestSuite_test_parse_invalid;
+
+#include "test/engines/ultima/ultima8/misc/box.h"
+
+static U8BoxTestSuite suite_U8BoxTestSuite;
+
+static CxxTest::List Tests_U8BoxTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8BoxTestSuite( "test/engines/ultima/ultima8/misc/box.h", 7, "U8BoxTestSuite", suite_U8BoxTestSuite, Tests_U8BoxTestSuite );
+
+static class TestDescription_U8BoxTestSuite_test_simple_box : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8BoxTestSuite_test_simple_box() : CxxTest::RealTestDescription( Tests_U8BoxTestSuite, suiteDescription_U8BoxTestSuite, 12, "test_simple_box" ) {}
+ void runTest() { suite_U8BoxTestSuite.test_simple_box(); }
+} testDescription_U8BoxTestSuite_test_simple_box;
+
+#include "test/engines/ultima/ultima8/misc/direction_util.h"
+
+static U8DirectionTestSuite suite_U8DirectionTestSuite;
+
+static CxxTest::List Tests_U8DirectionTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8DirectionTestSuite( "test/engines/ultima/ultima8/misc/direction_util.h", 8, "U8DirectionTestSuite", suite_U8DirectionTestSuite, Tests_U8DirectionTestSuite );
+
+static class TestDescription_U8DirectionTestSuite_test_direction_get : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8DirectionTestSuite_test_direction_get() : CxxTest::RealTestDescription( Tests_U8DirectionTestSuite, suiteDescription_U8DirectionTestSuite, 29, "test_direction_get" ) {}
+ void runTest() { suite_U8DirectionTestSuite.test_direction_get(); }
+} testDescription_U8DirectionTestSuite_test_direction_get;
+
+static class TestDescription_U8DirectionTestSuite_test_direction_get_worlddir : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8DirectionTestSuite_test_direction_get_worlddir() : CxxTest::RealTestDescription( Tests_U8DirectionTestSuite, suiteDescription_U8DirectionTestSuite, 46, "test_direction_get_worlddir" ) {}
+ void runTest() { suite_U8DirectionTestSuite.test_direction_get_worlddir(); }
+} testDescription_U8DirectionTestSuite_test_direction_get_worlddir;
+
+static class TestDescription_U8DirectionTestSuite_test_direction_conversions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8DirectionTestSuite_test_direction_conversions() : CxxTest::RealTestDescription( Tests_U8DirectionTestSuite, suiteDescription_U8DirectionTestSuite, 51, "test_direction_conversions" ) {}
+ void runTest() { suite_U8DirectionTestSuite.test_direction_conversions(); }
+} testDescription_U8DirectionTestSuite_test_direction_conversions;
+
+#include "test/engines/ultima/ultima8/misc/id_man.h"
+
+static U8IdManTestSuite suite_U8IdManTestSuite;
+
+static CxxTest::List Tests_U8IdManTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8IdManTestSuite( "test/engines/ultima/ultima8/misc/id_man.h", 8, "U8IdManTestSuite", suite_U8IdManTestSuite, Tests_U8IdManTestSuite );
+
+static class TestDescription_U8IdManTestSuite_test_trim_spaces : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8IdManTestSuite_test_trim_spaces() : CxxTest::RealTestDescription( Tests_U8IdManTestSuite, suiteDescription_U8IdManTestSuite, 14, "test_trim_spaces" ) {}
+ void runTest() { suite_U8IdManTestSuite.test_trim_spaces(); }
+} testDescription_U8IdManTestSuite_test_trim_spaces;
+
+#include "test/engines/ultima/ultima8/misc/util.h"
+
+static U8UtilTestSuite suite_U8UtilTestSuite;
+
+static CxxTest::List Tests_U8UtilTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8UtilTestSuite( "test/engines/ultima/ultima8/misc/util.h", 8, "U8UtilTestSuite", suite_U8UtilTestSuite, Tests_U8UtilTestSuite );
+
+static class TestDescription_U8UtilTestSuite_test_split_string : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8UtilTestSuite_test_split_string() : CxxTest::RealTestDescription( Tests_U8UtilTestSuite, suiteDescription_U8UtilTestSuite, 14, "test_split_string" ) {}
+ void runTest() { suite_U8UtilTestSuite.test_split_string(); }
+} testDescription_U8UtilTestSuite_test_split_string;
+
+static class TestDescription_U8UtilTestSuite_test_string_to_argv : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8UtilTestSuite_test_string_to_argv() : CxxTest::RealTestDescription( Tests_U8UtilTestSuite, suiteDescription_U8UtilTestSuite, 35, "test_string_to_argv" ) {}
+ void runTest() { suite_U8UtilTestSuite.test_string_to_argv(); }
+} testDescription_U8UtilTestSuite_test_string_to_argv;
+
+#include "test/engines/ultima/ultima8/usecode/bit_set.h"
+
+static U8BitSetTestSuite suite_U8BitSetTestSuite;
+
+static CxxTest::List Tests_U8BitSetTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8BitSetTestSuite( "test/engines/ultima/ultima8/usecode/bit_set.h", 7, "U8BitSetTestSuite", suite_U8BitSetTestSuite, Tests_U8BitSetTestSuite );
+
+static class TestDescription_U8BitSetTestSuite_test_set_get : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8BitSetTestSuite_test_set_get() : CxxTest::RealTestDescription( Tests_U8BitSetTestSuite, suiteDescription_U8BitSetTestSuite, 15, "test_set_get" ) {}
+ void runTest() { suite_U8BitSetTestSuite.test_set_get(); }
+} testDescription_U8BitSetTestSuite_test_set_get;
+
+static class TestDescription_U8BitSetTestSuite_test_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8BitSetTestSuite_test_clear() : CxxTest::RealTestDescription( Tests_U8BitSetTestSuite, suiteDescription_U8BitSetTestSuite, 29, "test_clear" ) {}
+ void runTest() { suite_U8BitSetTestSuite.test_clear(); }
+} testDescription_U8BitSetTestSuite_test_clear;
+
+#include "test/engines/ultima/ultima8/usecode/uc_list.h"
+
+static U8UCListTestSuite suite_U8UCListTestSuite;
+
+static CxxTest::List Tests_U8UCListTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8UCListTestSuite( "test/engines/ultima/ultima8/usecode/uc_list.h", 7, "U8UCListTestSuite", suite_U8UCListTestSuite, Tests_U8UCListTestSuite );
+
+static class TestDescription_U8UCListTestSuite_test_static_list : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8UCListTestSuite_test_static_list() : CxxTest::RealTestDescription( Tests_U8UCListTestSuite, suiteDescription_U8UCListTestSuite, 12, "test_static_list" ) {}
+ void runTest() { suite_U8UCListTestSuite.test_static_list(); }
+} testDescription_U8UCListTestSuite_test_static_list;
+
+#include "test/engines/ultima/ultima8/usecode/uc_stack.h"
+
+static U8UCStackTestSuite suite_U8UCStackTestSuite;
+
+static CxxTest::List Tests_U8UCStackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8UCStackTestSuite( "test/engines/ultima/ultima8/usecode/uc_stack.h", 7, "U8UCStackTestSuite", suite_U8UCStackTestSuite, Tests_U8UCStackTestSuite );
+
+static class TestDescription_U8UCStackTestSuite_test_static_stack : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8UCStackTestSuite_test_static_stack() : CxxTest::RealTestDescription( Tests_U8UCStackTestSuite, suiteDescription_U8UCStackTestSuite, 12, "test_static_stack" ) {}
+ void runTest() { suite_U8UCStackTestSuite.test_static_stack(); }
+} testDescription_U8UCStackTestSuite_test_static_stack;
+
+static class TestDescription_U8UCStackTestSuite_test_dynamic_stack : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8UCStackTestSuite_test_dynamic_stack() : CxxTest::RealTestDescription( Tests_U8UCStackTestSuite, suiteDescription_U8UCStackTestSuite, 17, "test_dynamic_stack" ) {}
+ void runTest() { suite_U8UCStackTestSuite.test_dynamic_stack(); }
+} testDescription_U8UCStackTestSuite_test_dynamic_stack;
+
+#include "test/engines/ultima/ultima8/world/sort_item.h"
+
+static U8SortItemTestSuite suite_U8SortItemTestSuite;
+
+static CxxTest::List Tests_U8SortItemTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_U8SortItemTestSuite( "test/engines/ultima/ultima8/world/sort_item.h", 10, "U8SortItemTestSuite", suite_U8SortItemTestSuite, Tests_U8SortItemTestSuite );
+
+static class TestDescription_U8SortItemTestSuite_test_screenspace_position : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_screenspace_position() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 19, "test_screenspace_position" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_screenspace_position(); }
+} testDescription_U8SortItemTestSuite_test_screenspace_position;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_y_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_y_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 41, "test_basic_y_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_y_sort(); }
+} testDescription_U8SortItemTestSuite_test_basic_y_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_x_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_x_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 58, "test_basic_x_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_x_sort(); }
+} testDescription_U8SortItemTestSuite_test_basic_x_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_z_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_z_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 75, "test_basic_z_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_z_sort(); }
+} testDescription_U8SortItemTestSuite_test_basic_z_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_sprite_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_sprite_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 92, "test_sprite_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_sprite_sort(); }
+} testDescription_U8SortItemTestSuite_test_sprite_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_inv_item_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_inv_item_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 114, "test_inv_item_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_inv_item_sort(); }
+} testDescription_U8SortItemTestSuite_test_inv_item_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_flat_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_flat_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 135, "test_flat_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_flat_sort(); }
+} testDescription_U8SortItemTestSuite_test_flat_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_non_flat_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_non_flat_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 191, "test_non_flat_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_non_flat_sort(); }
+} testDescription_U8SortItemTestSuite_test_non_flat_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_main_actor_roof_bug : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_main_actor_roof_bug() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 214, "test_main_actor_roof_bug" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_main_actor_roof_bug(); }
+} testDescription_U8SortItemTestSuite_test_main_actor_roof_bug;
+
+static class TestDescription_U8SortItemTestSuite_test_nonflat_transparent_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_nonflat_transparent_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 252, "test_nonflat_transparent_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_nonflat_transparent_sort(); }
+} testDescription_U8SortItemTestSuite_test_nonflat_transparent_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_nonflat_partial_front_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_nonflat_partial_front_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 274, "test_nonflat_partial_front_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_nonflat_partial_front_sort(); }
+} testDescription_U8SortItemTestSuite_test_nonflat_partial_front_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_ignore_z_non_solid_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_ignore_z_non_solid_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 302, "test_ignore_z_non_solid_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_ignore_z_non_solid_sort(); }
+} testDescription_U8SortItemTestSuite_test_ignore_z_non_solid_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_x_flat_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_x_flat_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 324, "test_x_flat_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_x_flat_sort(); }
+} testDescription_U8SortItemTestSuite_test_x_flat_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_x_flat_z_tolerance_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_x_flat_z_tolerance_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 348, "test_x_flat_z_tolerance_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_x_flat_z_tolerance_sort(); }
+} testDescription_U8SortItemTestSuite_test_x_flat_z_tolerance_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_x_flat_vs_thin_wall_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_x_flat_vs_thin_wall_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 376, "test_x_flat_vs_thin_wall_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_x_flat_vs_thin_wall_sort(); }
+} testDescription_U8SortItemTestSuite_test_x_flat_vs_thin_wall_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_misplaced_flat_bug : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_misplaced_flat_bug() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 399, "test_misplaced_flat_bug" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_misplaced_flat_bug(); }
+} testDescription_U8SortItemTestSuite_test_misplaced_flat_bug;
+
+static class TestDescription_U8SortItemTestSuite_test_x_flat_layered_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_x_flat_layered_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 422, "test_x_flat_layered_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_x_flat_layered_sort(); }
+} testDescription_U8SortItemTestSuite_test_x_flat_layered_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_layered_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_layered_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 445, "test_y_flat_layered_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_layered_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_layered_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_edge_overlap_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_edge_overlap_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 468, "test_y_flat_edge_overlap_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_edge_overlap_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_edge_overlap_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_same_position_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_same_position_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 493, "test_y_flat_same_position_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_same_position_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_same_position_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 520, "test_y_flat_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_z_tolerance_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_z_tolerance_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 547, "test_y_flat_z_tolerance_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_z_tolerance_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_z_tolerance_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_exception_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_exception_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 574, "test_y_flat_exception_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_exception_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_exception_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_y_flat_intersect_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_y_flat_intersect_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 598, "test_y_flat_intersect_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_y_flat_intersect_sort(); }
+} testDescription_U8SortItemTestSuite_test_y_flat_intersect_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_z_flat_vs_x_flat_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_z_flat_vs_x_flat_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 624, "test_z_flat_vs_x_flat_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_z_flat_vs_x_flat_sort(); }
+} testDescription_U8SortItemTestSuite_test_z_flat_vs_x_flat_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_nonflat_z_clear_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_nonflat_z_clear_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 650, "test_nonflat_z_clear_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_nonflat_z_clear_sort(); }
+} testDescription_U8SortItemTestSuite_test_nonflat_z_clear_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_anim_easter_egg : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_anim_easter_egg() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 676, "test_anim_easter_egg" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_anim_easter_egg(); }
+} testDescription_U8SortItemTestSuite_test_anim_easter_egg;
+
+static class TestDescription_U8SortItemTestSuite_test_armor_of_flames_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_armor_of_flames_sort() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 697, "test_armor_of_flames_sort" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_armor_of_flames_sort(); }
+} testDescription_U8SortItemTestSuite_test_armor_of_flames_sort;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_occludes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_occludes() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 714, "test_basic_occludes" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_occludes(); }
+} testDescription_U8SortItemTestSuite_test_basic_occludes;
+
+static class TestDescription_U8SortItemTestSuite_test_frame_offset_occludes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_frame_offset_occludes() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 736, "test_frame_offset_occludes" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_frame_offset_occludes(); }
+} testDescription_U8SortItemTestSuite_test_frame_offset_occludes;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_contains() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 761, "test_basic_contains" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_contains(); }
+} testDescription_U8SortItemTestSuite_test_basic_contains;
+
+static class TestDescription_U8SortItemTestSuite_test_basic_overlap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_U8SortItemTestSuite_test_basic_overlap() : CxxTest::RealTestDescription( Tests_U8SortItemTestSuite, suiteDescription_U8SortItemTestSuite, 797, "test_basic_overlap" ) {}
+ void runTest() { suite_U8SortItemTestSuite.test_basic_overlap(); }
+} testDescription_U8SortItemTestSuite_test_basic_overlap;
+
+#include <cxxtest/Root.cpp>